@@ -1,4 +1,6 @@
 #include "algoritambaza.h"
+#include "generatorulaza.h"
+#include <cstring>
 #include <fstream>
 
 void AlgoritamBaza::timerEvent(QTimerEvent */* unused */)
@@ -10,6 +12,8 @@ AlgoritamBaza::AlgoritamBaza(QWidget *pCrtanje, int pauzaKoraka, const bool &nai
     : QObject{}, _pauzaKoraka{pauzaKoraka},
       _timerId{INVALID_TIMER_ID}, _semafor(0),
       _unistiAnimaciju(false), _pNit(nullptr),
+      _rokIzvrsavanja(std::chrono::steady_clock::time_point::max()),
+      _zastavicaPrekida(nullptr), _brojProveraPrekida(0), _prekinut(false),
       _pCrtanje{pCrtanje}, _naivni(naivni)
 {}
 
@@ -77,18 +81,116 @@ void AlgoritamBaza::promeniDuzinuPauze(int duzinaPauze)
     _timerId = startTimer(_pauzaKoraka);
 }
 
+void AlgoritamBaza::postaviPrekid(std::chrono::steady_clock::time_point rok,
+                                  const std::atomic<bool> *zastavica)
+{
+    _rokIzvrsavanja = rok;
+    _zastavicaPrekida = zastavica;
+    _brojProveraPrekida = 0;
+    _prekinut = false;
+}
+
+bool AlgoritamBaza::prekinut() const
+{
+    return _prekinut;
+}
+
+int AlgoritamBaza::velicinaIzlaza() const
+{
+    return 0;
+}
+
+const std::vector<AlgoritamBaza::Faza> &AlgoritamBaza::faze() const
+{
+    return _faze;
+}
+
+AlgoritamBaza::Faza &AlgoritamBaza::nadjiFazu(const char *ime)
+{
+    /* Faza ima malo, pa je linearna pretraga dovoljno brza */
+    for (auto &faza : _faze) {
+        if (faza.ime == ime || std::strcmp(faza.ime, ime) == 0)
+            return faza;
+    }
+    _faze.push_back({ime, 0});
+    return _faze.back();
+}
+
+void AlgoritamBaza::dodajTrajanjeFaze(const char *ime, double trajanje)
+{
+    nadjiFazu(ime).trajanje += trajanje;
+}
+
+void AlgoritamBaza::postaviUdeoFaze(const char *ime, double udeo)
+{
+    nadjiFazu(ime).udeo = udeo;
+}
+
 bool AlgoritamBaza::updateCanvasAndBlock()
 {
     if (_pCrtanje) {
         _pCrtanje->update();
         _semafor.acquire();
+        return _unistiAnimaciju;
     }
-    return _unistiAnimaciju;
+
+    /* Bez animacije se makro poziva u unutrasnjim petljama, pa se sat cita
+     * tek na svakih 256 poziva; prekid ostaje vazeci do kraja izvrsavanja */
+    if (!_prekinut && (++_brojProveraPrekida & 0xFFu) == 0)
+        _prekinut = (_zastavicaPrekida && _zastavicaPrekida->load(std::memory_order_relaxed)) ||
+                    std::chrono::steady_clock::now() > _rokIzvrsavanja;
+    return _prekinut;
+}
+
+AlgoritamBaza::PosmatracAlgoritma::PosmatracAlgoritma(AlgoritamBaza &algoritam)
+    : _algoritam(algoritam), _faza(nullptr)
+{}
+
+AlgoritamBaza::PosmatracAlgoritma::~PosmatracAlgoritma()
+{
+    zavrsiFazu();
+}
+
+bool AlgoritamBaza::PosmatracAlgoritma::korak()
+{
+    return _algoritam.updateCanvasAndBlock();
+}
+
+bool AlgoritamBaza::PosmatracAlgoritma::crta() const
+{
+    return _algoritam._pCrtanje != nullptr;
+}
+
+void AlgoritamBaza::PosmatracAlgoritma::faza(const char *ime)
+{
+#ifdef MERENJE_FAZA
+    zavrsiFazu();
+    _faza = ime;
+    _pocetak = std::chrono::steady_clock::now();
+#else
+    (void)ime;
+#endif
+}
+
+void AlgoritamBaza::PosmatracAlgoritma::udeo(double udeo)
+{
+    /* Bez merenja faza _faza ostaje nullptr */
+    if (_faza)
+        _algoritam.postaviUdeoFaze(_faza, udeo);
+}
+
+void AlgoritamBaza::PosmatracAlgoritma::zavrsiFazu()
+{
+    if (!_faza)
+        return;
+
+    const auto kraj = std::chrono::steady_clock::now();
+    _algoritam.dodajTrajanjeFaze(_faza, std::chrono::duration<double>(kraj - _pocetak).count());
+    _faza = nullptr;
 }
 
 std::vector<QPoint> AlgoritamBaza::generisiNasumicneTacke(int brojTacaka) const
 {
-    srand(static_cast<unsigned>(time(nullptr)));
     int xMax;
     int yMax;
 
@@ -99,19 +201,18 @@ std::vector<QPoint> AlgoritamBaza::generisiNasumicneTacke(int brojTacaka) const
     }
     else
     {
-        xMax = CANVAS_WIDTH;
-        yMax = CANVAS_HEIGHT;
+        /* Bez oblasti crtanja (merenje) oblast raste sa brojem objekata */
+        xMax = yMax = GeneratorUlaza::stranicaOblasti(brojTacaka, GeneratorUlaza::tekuci().raspodela());
     }
 
     int xMin = DRAWING_BORDER;
     int yMin = DRAWING_BORDER;
 
     std::vector<QPoint> randomPoints;
+    randomPoints.reserve(static_cast<size_t>(brojTacaka));
 
-    int xDiff = xMax-xMin;
-    int yDiff = yMax-yMin;
-    for(int i=0; i < brojTacaka; i++)
-        randomPoints.emplace_back(xMin + rand()%xDiff, yMin + rand()%yDiff);
+    for (const auto &t : GeneratorUlaza::tekuci().tacke2D(brojTacaka, xMin, xMax-1, yMin, yMax-1, true))
+        randomPoints.emplace_back(static_cast<int>(t.x), static_cast<int>(t.y));
 
     return randomPoints;
 }
@@ -30,8 +30,13 @@
 #include <QOpenGLWidget>
 #include <QCheckBox>
 
+#include <atomic>
+#include <chrono>
+#include <vector>
+
 #include "animacijanit.h"
 #include "config.h"
+#include "ga_core/posmatrac.h"
 
 #define AlgoritamBaza_updateCanvasAndBlock() \
     if (updateCanvasAndBlock()) \
@@ -39,6 +44,32 @@
         return; \
     }
 
+/* Meri trajanje imenovane faze od mesta poziva do kraja tekuceg opsega
+ * (npr. "sortiranje"); trajanja faza istog imena se sabiraju. Bez
+ * MERENJE_FAZA makro se ne prevodi ni u sta. */
+#ifdef MERENJE_FAZA
+#define AlgoritamBaza_faza_spoji(a, b) a##b
+#define AlgoritamBaza_faza_ime(linija) AlgoritamBaza_faza_spoji(_meracFaze, linija)
+#define AlgoritamBaza_faza(ime) \
+    const AlgoritamBaza::MeracFaze AlgoritamBaza_faza_ime(__LINE__)(*this, ime)
+#else
+#define AlgoritamBaza_faza(ime)
+#endif
+
+/* Faza koja se ponavlja u petlji (npr. po temenu): sabirac se deklarise pre
+ * petlje, a svaki deo faze meri od mesta poziva do kraja tekuceg opsega.
+ * Delovi se sabiraju lokalno, bez trazenja faze po imenu, i fazi se dodaju
+ * jednom, kada sabirac izadje iz opsega. */
+#ifdef MERENJE_FAZA
+#define AlgoritamBaza_sabiracFaze(sabirac, ime) \
+    AlgoritamBaza::SabiracFaze sabirac(*this, ime)
+#define AlgoritamBaza_deoFaze(sabirac) \
+    const AlgoritamBaza::SabiracFaze::Deo AlgoritamBaza_faza_ime(__LINE__)(sabirac)
+#else
+#define AlgoritamBaza_sabiracFaze(sabirac, ime)
+#define AlgoritamBaza_deoFaze(sabirac)
+#endif
+
 /* Nasledjuje se QObject koji omogucava rad sa signalima i slotovima.
  */
 class AlgoritamBaza : public QObject
@@ -57,6 +88,12 @@ private:
     /* Nit koja izvrsava algoritam */
     AnimacijaNit *_pNit;
 
+    /* Kooperativni prekid izvrsavanja bez animacije (postaviPrekid) */
+    std::chrono::steady_clock::time_point _rokIzvrsavanja;
+    const std::atomic<bool> *_zastavicaPrekida;
+    unsigned _brojProveraPrekida;
+    bool _prekinut;
+
     ///
     /// \brief timerEvent - funkcija koja se poziva na svakih _delayMs ms.
     ///     U njoj samo oslobadjamo semafor i na taj nacin omogucavamo da se predje na sledeci
@@ -126,6 +163,141 @@ public:
     ///
     void promeniDuzinuPauze(int duzinaPauze);
 
+    ///
+    /// \brief postaviPrekid - prekid izvrsavanja bez oblasti crtanja (merenje performansi).
+    ///     Algoritam se zaustavlja na prvom AlgoritamBaza_updateCanvasAndBlock() posle roka
+    ///     ili posto se zastavica postavi na true, isto kao pri zaustavljanju animacije.
+    /// \param rok - trenutak posle koga se izvrsavanje prekida
+    /// \param zastavica - spoljasnji zahtev za prekid; nullptr ako ga nema
+    ///
+    void postaviPrekid(std::chrono::steady_clock::time_point rok,
+                       const std::atomic<bool> *zastavica = nullptr);
+
+    /* Da li je poslednje izvrsavanje prekinuto (postaviPrekid) */
+    bool prekinut() const;
+
+    ///
+    /// \brief velicinaIzlaza - velicina izlaza poslednjeg izvrsavanja (npr. broj
+    ///     temena omotaca), za procenu slozenosti zavisne od izlaza (n log h)
+    /// \return 0 ako algoritam ne prijavljuje velicinu izlaza
+    ///
+    virtual int velicinaIzlaza() const;
+
+    /* Ukupno trajanje jedne faze algoritma, u sekundama, i udeo koji faza
+     * prijavljuje (npr. udeo odbacenih tacaka); udeo < 0 ako ga nema */
+    struct Faza {
+        const char *ime;
+        double trajanje;
+        double udeo = -1;
+    };
+
+    ///
+    /// \brief faze - izmerene faze poslednjeg izvrsavanja, redom prvog ulaska
+    ///     (prazno ako MERENJE_FAZA nije definisan)
+    ///
+    const std::vector<Faza> &faze() const;
+
+    ///
+    /// \brief MeracFaze - meri vreme od konstrukcije do unistenja i dodaje ga fazi;
+    ///     koristiti preko makroa AlgoritamBaza_faza
+    ///
+    class MeracFaze
+    {
+    public:
+        MeracFaze(AlgoritamBaza &algoritam, const char *ime)
+            : _algoritam(algoritam), _ime(ime), _pocetak(std::chrono::steady_clock::now())
+        {}
+
+        ~MeracFaze()
+        {
+            const auto kraj = std::chrono::steady_clock::now();
+            _algoritam.dodajTrajanjeFaze(_ime, std::chrono::duration<double>(kraj - _pocetak).count());
+        }
+
+        MeracFaze(const MeracFaze &) = delete;
+        MeracFaze& operator=(const MeracFaze &) = delete;
+
+    private:
+        AlgoritamBaza &_algoritam;
+        const char *const _ime;
+        const std::chrono::steady_clock::time_point _pocetak;
+    };
+
+    ///
+    /// \brief SabiracFaze - sabira trajanja delova faze i dodaje ih fazi pri
+    ///     unistenju; koristiti preko makroa AlgoritamBaza_sabiracFaze i
+    ///     AlgoritamBaza_deoFaze
+    ///
+    class SabiracFaze
+    {
+    public:
+        /* Faza se prijavljuje odmah, da bi redosled faza bio redosled ulaska */
+        SabiracFaze(AlgoritamBaza &algoritam, const char *ime)
+            : _algoritam(algoritam), _ime(ime)
+        {
+            _algoritam.dodajTrajanjeFaze(_ime, 0);
+        }
+
+        ~SabiracFaze()
+        {
+            _algoritam.dodajTrajanjeFaze(_ime, std::chrono::duration<double>(_trajanje).count());
+        }
+
+        SabiracFaze(const SabiracFaze &) = delete;
+        SabiracFaze& operator=(const SabiracFaze &) = delete;
+
+        class Deo
+        {
+        public:
+            explicit Deo(SabiracFaze &sabirac)
+                : _sabirac(sabirac), _pocetak(std::chrono::steady_clock::now())
+            {}
+
+            ~Deo()
+            {
+                _sabirac._trajanje += std::chrono::steady_clock::now() - _pocetak;
+            }
+
+            Deo(const Deo &) = delete;
+            Deo& operator=(const Deo &) = delete;
+
+        private:
+            SabiracFaze &_sabirac;
+            const std::chrono::steady_clock::time_point _pocetak;
+        };
+
+    private:
+        AlgoritamBaza &_algoritam;
+        const char *const _ime;
+        std::chrono::steady_clock::duration _trajanje{};
+    };
+
+    ///
+    /// \brief PosmatracAlgoritma - posmatrac za algoritme iz ga_core: korak() je
+    ///     updateCanvasAndBlock(), a faze se mere kao sa AlgoritamBaza_faza
+    ///
+    class PosmatracAlgoritma : public geometrija::Posmatrac
+    {
+    public:
+        explicit PosmatracAlgoritma(AlgoritamBaza &algoritam);
+        ~PosmatracAlgoritma() override;
+
+        PosmatracAlgoritma(const PosmatracAlgoritma &) = delete;
+        PosmatracAlgoritma& operator=(const PosmatracAlgoritma &) = delete;
+
+        bool korak() override;
+        bool crta() const override;
+        void faza(const char *ime) override;
+        void udeo(double udeo) override;
+
+    private:
+        void zavrsiFazu();
+
+        AlgoritamBaza &_algoritam;
+        const char *_faza;
+        std::chrono::steady_clock::time_point _pocetak;
+    };
+
 signals:
     void animacijaZavrsila();
 
@@ -144,11 +316,24 @@ protected:
     ///
     bool updateCanvasAndBlock();
 
+    void dodajTrajanjeFaze(const char *ime, double trajanje);
+    void postaviUdeoFaze(const char *ime, double udeo);
+
+    ///
+    /// \brief generisiNasumicneTacke - tacke iz generatora tekuce niti
+    ///     (GeneratorUlaza::tekuci()), u granicama oblasti crtanja
+    ///
     std::vector<QPoint> generisiNasumicneTacke(int brojTacaka = BROJ_SLUCAJNIH_OBJEKATA) const;
     std::vector<QPoint> ucitajPodatkeIzDatoteke(std::string imeDatoteke) const;
 
     /* Parametar naivnosti */
     const bool &_naivni;
+
+private:
+    Faza &nadjiFazu(const char *ime);
+
+    /* Izmerene faze; imena su string literali, pa se cuvaju kao pokazivaci */
+    std::vector<Faza> _faze;
 };
 
 #endif // ALGORITAMBAZA_H
@@ -0,0 +1,70 @@
+# Algoritmi i zajednicki deo merenja; koriste ih i GA6 (GUI) i ga_bench (komandna linija).
+INCLUDEPATH += $$PWD
+
+include(ga_core/ga_core.pri)
+
+# Revizija koda koja se upisuje uz sacuvane rezultate merenja. Na unix-u se
+# revizija.cpp pravi pri svakom prevodjenju (revizija.sh), pa revizija ostaje
+# tacna i posle novog commit-a bez ponovnog pokretanja qmake-a; na ostalim
+# sistemima se cita pri pokretanju qmake-a.
+unix {
+    revizija.target = revizija.cpp
+    revizija.commands = sh $$shell_quote($$PWD/revizija.sh) $$shell_quote($$PWD) revizija.cpp
+    revizija.depends = FORCE
+    QMAKE_EXTRA_TARGETS += revizija
+    GENERATED_SOURCES += revizija.cpp
+    QMAKE_CLEAN += revizija.cpp
+    DEFINES += REVIZIJA_PRI_PREVODJENJU
+} else {
+    GIT_REVIZIJA = $$system(git -C $$PWD describe --always --dirty 2> $$QMAKE_SYSTEM_NULL_DEVICE)
+    !isEmpty(GIT_REVIZIJA): DEFINES += GIT_REVIZIJA=\\\"$$GIT_REVIZIJA\\\"
+}
+
+SOURCES += \
+    $$PWD/algoritambaza.cpp \
+    $$PWD/algoritmi_sa_vezbi/ga00_demoiscrtavanja.cpp \
+    $$PWD/algoritmi_sa_vezbi/ga01_brisucaprava.cpp \
+    $$PWD/algoritmi_sa_vezbi/ga02_3discrtavanje.cpp \
+    $$PWD/algoritmi_sa_vezbi/ga03_konveksniomotac.cpp \
+    $$PWD/algoritmi_sa_vezbi/ga04_konveksniomotac3d.cpp \
+    $$PWD/algoritmi_sa_vezbi/ga05_preseciduzi.cpp \
+    $$PWD/algoritmi_sa_vezbi/ga06_dcel.cpp \
+    $$PWD/algoritmi_sa_vezbi/ga06_dceldemo.cpp \
+    $$PWD/algoritmi_sa_vezbi/ga07_triangulation.cpp \
+    $$PWD/algoritmi_studentski_projekti/ga06_presekPravougaonika.cpp \
+    $$PWD/algoritmi_studentski_projekti/watchmanroute.cpp \
+    $$PWD/animacijanit.cpp \
+    $$PWD/generatorulaza.cpp \
+    $$PWD/hardverskibrojaci.cpp \
+    $$PWD/merenje.cpp \
+    $$PWD/pomocnefunkcije.cpp \
+    $$PWD/pracenjealokacija.cpp \
+    $$PWD/rezultatimerenja.cpp \
+    $$PWD/slozenost.cpp
+
+HEADERS += \
+    $$PWD/algoritambaza.h \
+    $$PWD/algoritmi_sa_vezbi/ga00_demoiscrtavanja.h \
+    $$PWD/algoritmi_sa_vezbi/ga01_brisucaprava.h \
+    $$PWD/algoritmi_sa_vezbi/ga02_3discrtavanje.h \
+    $$PWD/algoritmi_sa_vezbi/ga03_konveksniomotac.h \
+    $$PWD/algoritmi_sa_vezbi/ga04_konveksni3dDatastructures.h \
+    $$PWD/algoritmi_sa_vezbi/ga04_konveksniomotac3d.h \
+    $$PWD/algoritmi_sa_vezbi/ga05_datastructures.h \
+    $$PWD/algoritmi_sa_vezbi/ga05_preseciduzi.h \
+    $$PWD/algoritmi_sa_vezbi/ga06_dcel.h \
+    $$PWD/algoritmi_sa_vezbi/ga06_dceldemo.h \
+    $$PWD/algoritmi_sa_vezbi/ga07_datastructures.h \
+    $$PWD/algoritmi_sa_vezbi/ga07_triangulation.h \
+    $$PWD/algoritmi_studentski_projekti/ga06_presekPravougaonika.h \
+    $$PWD/algoritmi_studentski_projekti/watchmanroute.h \
+    $$PWD/animacijanit.h \
+    $$PWD/config.h \
+    $$PWD/generatorulaza.h \
+    $$PWD/hardverskibrojaci.h \
+    $$PWD/merenje.h \
+    $$PWD/pomocnefunkcije.h \
+    $$PWD/pracenjealokacija.h \
+    $$PWD/rezultatimerenja.h \
+    $$PWD/slozenost.h \
+    $$PWD/tipalgoritma.h
@@ -3,6 +3,8 @@
 #include <QVector3D>
 #include <fstream>
 
+#include "generatorulaza.h"
+
 Discrtavanje::Discrtavanje(QWidget *pCrtanje,
                            int pauzaKoraka,
                            const bool &naivni,
@@ -56,15 +58,12 @@ void Discrtavanje::crtajNaivniAlgoritam(QPainter *) const
 
 std::vector<QVector3D> Discrtavanje::generisiNasumicneTacke(int brojTacaka) const
 {
-    srand(static_cast<unsigned>(time(nullptr)));
-
     std::vector<QVector3D> randomPoints;
 
-    for(int i=0; i < brojTacaka; i++)
-        randomPoints.emplace_back(
-           1.f*rand()/RAND_MAX,
-           1.f*rand()/RAND_MAX,
-           1.f*rand()/RAND_MAX);
+    for (const auto &t : GeneratorUlaza::tekuci().tacke3D(brojTacaka))
+        randomPoints.emplace_back(static_cast<float>(t.x),
+                                  static_cast<float>(t.y),
+                                  static_cast<float>(t.z));
 
     return randomPoints;
 }
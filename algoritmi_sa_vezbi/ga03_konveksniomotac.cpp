@@ -1,64 +1,76 @@
 #include "ga03_konveksniomotac.h"
 #include "pomocnefunkcije.h"
+#include "ga_core/paketnipredikati.h"
 
 #include <algorithm>
 #include <QPainterPath>
 
+namespace {
+
+/* Predikati nad tipom koordinata iz config.h; QPoint cuva int, pa siri tip
+ * samo prosiruje medjurezultate */
+using Koordinata = KonveksniOmotac::Koordinata;
+
+/* AlgoritamBaza cuva referencu na zastavicu naivnog algoritma */
+const bool NIJE_NAIVNI = false;
+
+inline geometrija::Siroki<Koordinata> povrsina(const QPoint &A, const QPoint &B, const QPoint &C)
+{
+    return geometrija::povrsinaTrougla<Koordinata>(A.x(), A.y(), B.x(), B.y(), C.x(), C.y());
+}
+
+}
+
 KonveksniOmotac::KonveksniOmotac(QWidget *pCrtanje,
                                  int pauzaKoraka,
                                  const bool &naivni,
                                  std::string imeDatoteke,
-                                 int brojTacaka)
-    : AlgoritamBaza(pCrtanje, pauzaKoraka, naivni)
+                                 int brojTacaka,
+                                 const geometrija::ParametriOmotaca &parametri)
+    : AlgoritamBaza(pCrtanje, pauzaKoraka, naivni), _parametri(parametri)
 {
     if (imeDatoteke == "")
         _tacke = generisiNasumicneTacke(brojTacaka);
     else
         _tacke = ucitajPodatkeIzDatoteke(imeDatoteke);
     _k = _tacke.size();
+
+    _koordinate.reserve(_tacke.size());
+    for (const auto &tacka : _tacke)
+        _koordinate.push_back(tacka.x(), tacka.y());
 }
 
-void KonveksniOmotac::pokreniAlgoritam() {
-    /* Slozenost ovakvog (Gremovog) algoritma: O(nlogn).
-     * Dominira sortiranje, dok su ostali koraci linearni. */
-    _maxTacka = _tacke[0];
+KonveksniOmotac::KonveksniOmotac(const std::vector<QPoint> &tacke,
+                                 const geometrija::ParametriOmotaca &parametri)
+    : AlgoritamBaza(nullptr, 0, NIJE_NAIVNI), _tacke(tacke), _parametri(parametri)
+{
+    _k = _tacke.size();
 
-    for (auto i = 1ul; i < _tacke.size(); i++) {
-        if (_tacke[i].x() > _maxTacka.x() || (_tacke[i].x() == _maxTacka.x() && _tacke[i].y() < _maxTacka.y()))
-            _maxTacka = _tacke[i];
-    }
-    AlgoritamBaza_updateCanvasAndBlock()
+    _koordinate.reserve(_tacke.size());
+    for (const auto &tacka : _tacke)
+        _koordinate.push_back(tacka.x(), tacka.y());
+}
 
-    std::sort(_tacke.begin(), _tacke.end(), [&](const auto& lhs, const auto& rhs) {
-        int P = pomocneFunkcije::povrsinaTrougla(_maxTacka, lhs, rhs);
-        return  (P < 0) ||  (P == 0 && pomocneFunkcije::distanceKvadrat(_maxTacka, lhs)
-                             < pomocneFunkcije::distanceKvadrat(_maxTacka, rhs));
-    });
-
-    _konveksniOmotac.push_back(_maxTacka);
-    _konveksniOmotac.push_back(_tacke[1]);
-    unsigned pom = 2;
-    unsigned j = 2;
-
-    while(j < _tacke.size()) {
-        if(pomocneFunkcije::povrsinaTrougla(_konveksniOmotac[pom-2],
-                                            _konveksniOmotac[pom-1],
-                                            _tacke[j]) < 0)
-        {
-            _konveksniOmotac.push_back(_tacke[j]);
-            ++pom;
-            ++j;
-        }
-        else {
-            _konveksniOmotac.pop_back();
-            --pom;
-            // Ne smemo da povecamo j u ovom slucaju, jer nismo zavrsili sa ovom tackom
-        }
-        AlgoritamBaza_updateCanvasAndBlock()
-    }
+void KonveksniOmotac::pokreniAlgoritam() {
+    /* Slozenost ovakvog (Gremovog) algoritma: O(nlogn).
+     * Dominira sortiranje, dok su ostali koraci linearni; monotoni lanac
+     * sortira radix sortiranjem, bez poredjenja uglova.
+     * Sam algoritam je u ga_core (geometrija::konveksniOmotac); ovde se animira
+     * i izlaz prevodi iz indeksa u tacke. */
+    /* Uz animaciju se tekuci omotac crta preko indeksa u _tacke, koje
+     * odbacivanje unutrasnjih tacaka menja, pa se tada ne odbacuje */
+    auto parametri = _parametri;
+    parametri.odbacivanjeUnutrasnjih = parametri.odbacivanjeUnutrasnjih && !_pCrtanje;
+
+    PosmatracAlgoritma posmatrac(*this);
+    if (!geometrija::konveksniOmotac<Koordinata>(_koordinate, _omotac, parametri, &posmatrac))
+        return;
+
+    _konveksniOmotac.clear();
+    _konveksniOmotac.reserve(_omotac.size());
+    for (auto i : _omotac)
+        _konveksniOmotac.push_back(_tacke[i]);
 
-    _konveksniOmotac.push_back(_maxTacka);
-    AlgoritamBaza_updateCanvasAndBlock()
     emit animacijaZavrsila();
 }
 
@@ -72,16 +84,30 @@ void KonveksniOmotac::crtajAlgoritam(QPainter *painter) const {
         painter->drawPoint(tacka);
     }
 
+    /* Tekuci omotac se cita iz indeksa, koje algoritam menja u hodu */
     pen.setColor(Qt::blue);
     painter->setPen(pen);
-    for(auto i = 1ul; i < _konveksniOmotac.size(); i++) {
-       painter->drawLine(_konveksniOmotac[i-1], _konveksniOmotac[i]);
+    for(auto i = 1ul; i < _omotac.size(); i++) {
+       painter->drawLine(_tacke[_omotac[i-1]], _tacke[_omotac[i]]);
     }
 }
 
 void KonveksniOmotac::pokreniNaivniAlgoritam() {
     /* Slozenost naivnog algoritma: O(n^3).
      * Prolazi se kroz svaki par tacaka. */
+
+    /* Bez animacije se treca tacka trazi paketnim predikatom nad koordinatama
+     * prepisanim u nizove; sa animacijom se ide tacku po tacku, zbog crtanja */
+    std::vector<double> x, y;
+    if (!_pCrtanje) {
+        x.reserve(_tacke.size());
+        y.reserve(_tacke.size());
+        for (const auto &tacka : _tacke) {
+            x.push_back(tacka.x());
+            y.push_back(tacka.y());
+        }
+    }
+
     for (_i = 0; _i < _tacke.size(); _i++) {
         for (_j = 0; _j < _tacke.size(); _j++) {
             if (_i == _j) continue;
@@ -90,16 +116,24 @@ void KonveksniOmotac::pokreniNaivniAlgoritam() {
              * trecom tackom negativne, sto znaci da
              * je trojka negativne orijentacije */
             bool svePovrsineNegativne = true;
-            for (_k = 0; _k < _tacke.size(); _k++) {
-                if (_k == _i || _k == _j) continue;
-
-                _povrsina = pomocneFunkcije::povrsinaTrougla(_tacke[_i],
-                                                             _tacke[_j],
-                                                             _tacke[_k]);
+            if (!_pCrtanje) {
+                /* Tacke _i i _j su kolinearne same sa sobom, pa ih ne treba preskakati */
+                _k = geometrija::prvaOrijentacija(x[_i], y[_i], x[_j], y[_j],
+                                                       x.data(), y.data(), x.size(),
+                                                       geometrija::POZITIVNA);
+                svePovrsineNegativne = _k == _tacke.size();
                 AlgoritamBaza_updateCanvasAndBlock()
-                if (_povrsina > 0) {
-                    svePovrsineNegativne = false;
-                    break;
+            } else {
+                for (_k = 0; _k < _tacke.size(); _k++) {
+                    if (_k == _i || _k == _j) continue;
+
+                    const auto P = povrsina(_tacke[_i], _tacke[_j], _tacke[_k]);
+                    _povrsina = (P > 0) - (P < 0);
+                    AlgoritamBaza_updateCanvasAndBlock()
+                    if (_povrsina > 0) {
+                        svePovrsineNegativne = false;
+                        break;
+                    }
                 }
             }
 
@@ -206,3 +240,11 @@ const std::vector<QPoint> &KonveksniOmotac::getKonveksniOmotac() const
 {
     return _konveksniOmotac;
 }
+
+int KonveksniOmotac::velicinaIzlaza() const
+{
+    /* Omotac ponavlja prvo teme na kraju; naivni cuva ivice omotaca */
+    if (!_konveksniOmotac.empty())
+        return static_cast<int>(_konveksniOmotac.size()) - 1;
+    return static_cast<int>(_naivniOmotac.size());
+}
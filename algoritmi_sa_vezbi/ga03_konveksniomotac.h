@@ -2,15 +2,27 @@
 #define GA03_KONVEKSNIOMOTAC_H
 
 #include "algoritambaza.h"
+#include "ga_core/konveksniomotac2d.h"
+#include "ga_core/tacke.h"
+
+#include <cstdint>
 
 class KonveksniOmotac : public AlgoritamBaza
 {
 public:
+    /* Tip koordinata u predikatima omotaca (config.h) */
+    using Koordinata = KOORDINATA_OMOTACA;
+
     KonveksniOmotac(QWidget *pCrtanje,
                     int pauzaKoraka,
                     const bool &naivni = false,
                     std::string imeDatoteke = "",
-                    int brojTacaka = BROJ_SLUCAJNIH_OBJEKATA);
+                    int brojTacaka = BROJ_SLUCAJNIH_OBJEKATA,
+                    const geometrija::ParametriOmotaca &parametri = geometrija::ParametriOmotaca());
+
+    /* Omotac zadatih tacaka, bez crtanja (npr. poredjenje sa geometrija::paketniOmotaci) */
+    KonveksniOmotac(const std::vector<QPoint> &tacke,
+                    const geometrija::ParametriOmotaca &parametri = geometrija::ParametriOmotaca());
 
     void pokreniAlgoritam() final;
     void crtajAlgoritam(QPainter *painter) const final;
@@ -20,14 +32,23 @@ public:
     const std::vector<QPoint> &getKonveksniOmotac() const;
     const std::vector<QLine> &getNaivniOmotac() const;
 
+    int velicinaIzlaza() const final;
+
 private:
     void naglasiTrenutno(QPainter *painter, unsigned long i, const char *s) const;
 
     std::vector<QPoint> _tacke;
     std::vector<QPoint> _konveksniOmotac;
-    QPoint _maxTacka;
 
-    int _povrsina;
+    /* Izbor algoritma (geometrija::konveksniOmotac) */
+    geometrija::ParametriOmotaca _parametri;
+
+    /* Iste tacke kao nizovi koordinata, za geometrija::konveksniOmotac */
+    geometrija::Tacke2D<Koordinata> _koordinate;
+    /* Indeksi temena tekuceg omotaca u _tacke */
+    std::vector<uint32_t> _omotac;
+
+    int _povrsina;  /* znak povrsine tekuceg trougla */
     unsigned long _i, _j, _k;
     std::vector<QLine> _naivniOmotac;
 };
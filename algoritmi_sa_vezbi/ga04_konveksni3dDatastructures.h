@@ -2,13 +2,19 @@
 #define GA04_KONVEKSNI3DDATASTRUCTURES_H
 
 #include <QVector3D>
+#include <cstdint>
+#include <unordered_map>
 
+/* Temena, ivice i stranice omotaca su u bazenima (geometrija::Bazen), pa svako
+ * dobija indeks svog mesta u bazenu kao prvi argument konstruktora */
 class Teme {
 public:
-    Teme(float x, float y, float z)
-        :_koordinate(x, y, z), _obradjeno(false)
+    Teme(uint32_t indeks, float x, float y, float z)
+        :_koordinate(x, y, z), _obradjeno(false), _indeks(indeks)
     {}
 
+    uint32_t indeks() const { return _indeks; }
+
     /* Za pristup koordinatama */
     float x() const { return _koordinate.x(); }
     float y() const { return _koordinate.y(); }
@@ -22,23 +28,21 @@ public:
 private:
     QVector3D _koordinate;
     bool _obradjeno;
+    uint32_t _indeks;
 };
 
 class Stranica;
 
 class Ivica{
 public:
-    Ivica()
+    Ivica(uint32_t indeks, Teme* t1, Teme* t2)
         : _stranice {nullptr, nullptr},
           _obrisati {false},
-          _temena {nullptr, nullptr}
+          _temena {t1, t2},
+          _indeks {indeks}
     {}
 
-    Ivica(Teme* t1, Teme* t2)
-        : _stranice {nullptr, nullptr},
-          _obrisati {false},
-          _temena {t1, t2}
-    {}
+    uint32_t indeks() const { return _indeks; }
 
     void postavi_stranicu(Stranica* s)
     {
@@ -79,20 +83,19 @@ private:
     Stranica* _stranice[2];
     bool _obrisati;
     Teme* _temena[2];
+    uint32_t _indeks;
 };
 
 class Stranica{
 public:
-    Stranica()
-        : _temena{nullptr, nullptr, nullptr},
-          _vidljiva(false)
-    {}
-
-    Stranica(Teme* t1, Teme* t2, Teme* t3)
+    Stranica(uint32_t indeks, Teme* t1, Teme* t2, Teme* t3)
         : _temena{t1, t2, t3},
-          _vidljiva(false)
+          _vidljiva(false),
+          _indeks(indeks)
     { }
 
+    uint32_t indeks() const { return _indeks; }
+
     Teme* t1() const { return _temena[0]; }
     Teme* t2() const { return _temena[1]; }
     Teme* t3() const { return _temena[2]; }
@@ -121,28 +124,17 @@ public:
 private:
     Teme* _temena[3];
     bool _vidljiva;
+    uint32_t _indeks;
 };
 
-/* Struktura podataka za hesiranje ivica u neuredjenom skupu (hes tabeli);
- * kako su pokazivaci na temena jedinstveni, a ideja je da ivica bude jednaka
- * nezavisno od smera vektora, u redu je hesirati pokazivace na temena
- * odvojeno, a zatim formirati krajnji rezultat ekskluzivnom disjunkcijom */
-struct HashIvica {
-    size_t operator()(const Ivica *const ivica) const
-    {
-        const std::hash<Teme*> hasher;
-        return hasher(ivica->t1()) ^ hasher(ivica->t2());
-    }
-};
+/* Ivice se traze po paru temena, bez obzira na smer: kljuc su indeksi oba
+ * temena, manji u visih 32 bita, pa za pretragu ne treba praviti ivicu */
+inline uint64_t kljucIvice(const Teme *a, const Teme *b)
+{
+    const uint64_t i = a->indeks(), j = b->indeks();
+    return i < j ? (i << 32 | j) : (j << 32 | i);
+}
 
-/* Struktura za odredjivanje jednakosti dve ivice; jednake su ako su im ista
- * temena (u smislu pokazivaca), eventualno u suprotnom redosledu */
-struct EqIvica {
-    bool operator()(const Ivica *const l, const Ivica *const d) const
-    {
-        return (l->t1() == d->t1() && l->t2() == d->t2()) ||
-               (l->t1() == d->t2() && l->t2() == d->t1());
-    }
-};
+using SkupIvica = std::unordered_map<uint64_t, Ivica*>;
 
 #endif // GA04_KONVEKSNI3DDATASTRUCTURES_H
@@ -1,5 +1,8 @@
 #include "ga04_konveksniomotac3d.h"
 #include "pomocnefunkcije.h"
+#include "ga_core/konveksniomotac3d.h"
+#include "ga_core/paketnipredikati.h"
+#include "generatorulaza.h"
 
 #include <fstream>
 #include <cfloat>
@@ -9,70 +12,59 @@ KonveksniOmotac3D::KonveksniOmotac3D(QWidget *pCrtanje,
                                      int pauzaKoraka,
                                      const bool &naivni,
                                      std::string imeDatoteke,
-                                     int brojTacaka)
-        : AlgoritamBaza(pCrtanje, pauzaKoraka, naivni)
+                                     int brojTacaka,
+                                     StrategijaOmotaca3D strategija)
+        : AlgoritamBaza(pCrtanje, pauzaKoraka, naivni), _strategija(strategija)
 {
     if (imeDatoteke != "")
         _tacke = ucitajPodatkeIzDatoteke(imeDatoteke);
     else
         _tacke = generisiNasumicneTacke(brojTacaka);
+
+    _koordinate.reserve(_tacke.size());
+    for (auto t : _tacke)
+        _koordinate.push_back(t->x(), t->y(), t->z());
 }
 
 KonveksniOmotac3D::~KonveksniOmotac3D()
 {
-    for (auto t: _tacke)
-        delete t;
-
-    for (auto i: _ivice)
-        delete i;
-
-    for (auto ni: _naivneIvice)
-        delete ni;
-
-    for (auto s: _stranice)
-        delete s;
-
-    for(auto s: _naivniOmotac){
-        delete s;
-    }
+    /* Temena, ivice i stranice nemaju destruktore, pa se bazeni oslobadjaju
+     * po blokovima, bez obilaska objekata */
 }
 
 /*--------------------------------------------------------------------------------------------------*/
 /*---------------------------------Ucitavanje podataka----------------------------------------------*/
 /*--------------------------------------------------------------------------------------------------*/
-std::vector<Teme *> KonveksniOmotac3D::generisiNasumicneTacke(int brojTacaka) const
+std::vector<Teme *> KonveksniOmotac3D::generisiNasumicneTacke(int brojTacaka)
 {
-    srand(static_cast<unsigned>(time(nullptr)));
-
     std::vector<Teme*> randomPoints;
 
-    for(int i=0; i < brojTacaka; i++)
-        randomPoints.emplace_back(new Teme(
-           1.f*rand()/RAND_MAX,
-           1.f*rand()/RAND_MAX,
-           1.f*rand()/RAND_MAX));
+    for (const auto &t : GeneratorUlaza::tekuci().tacke3D(brojTacaka))
+        randomPoints.emplace_back(_bazenTemena.napravi(static_cast<float>(t.x),
+                                                       static_cast<float>(t.y),
+                                                       static_cast<float>(t.z)));
 
     return randomPoints;
 }
 
-std::vector<Teme *> KonveksniOmotac3D::ucitajPodatkeIzDatoteke(std::string imeDatoteke) const
+std::vector<Teme *> KonveksniOmotac3D::ucitajPodatkeIzDatoteke(std::string imeDatoteke)
 {
     std::ifstream inputFile(imeDatoteke);
     std::vector<Teme*> points;
     float x, y, z;
     while(inputFile >> x >> y >> z)
     {
-        points.emplace_back(new Teme(x, y, z));
+        points.emplace_back(_bazenTemena.napravi(x, y, z));
     }
     return points;
 }
 
-const std::unordered_set<Ivica *, HashIvica, EqIvica> &KonveksniOmotac3D::getIvice() const
+const SkupIvica &KonveksniOmotac3D::getIvice() const
 {
     return _ivice;
 }
 
-const std::unordered_set<Ivica *, HashIvica, EqIvica> &KonveksniOmotac3D::getNaivneIvice() const
+const SkupIvica &KonveksniOmotac3D::getNaivneIvice() const
 {
     return _naivneIvice;
 }
@@ -84,14 +76,40 @@ const std::unordered_set<Ivica *, HashIvica, EqIvica> &KonveksniOmotac3D::getNai
 
 void KonveksniOmotac3D::pokreniAlgoritam()
 {
+    if (_strategija == StrategijaOmotaca3D::QUICKHULL) {
+        /* Slozenost: O(n log n) u proseku; algoritam je u ga_core, a ovde se
+         * samo animira preko indeksa u _tacke */
+        PosmatracAlgoritma posmatrac(*this);
+        if (!geometrija::quickhull3D(_koordinate, _trouglovi, &posmatrac))
+            return;
+        emit animacijaZavrsila();
+        return;
+    }
+
+    if (_strategija == StrategijaOmotaca3D::KONFLIKTI)
+        izmesajTemena();
+
     /* Slozenost tetraedra: O(n), samo
      * jedan prolaz kroz temena. */
-    if(!Tetraedar()){
+    bool tetraedar;
+    {
+        AlgoritamBaza_faza("tetraedar");
+        tetraedar = Tetraedar();
+    }
+    if(!tetraedar){
         emit animacijaZavrsila();
         return;
     }
     AlgoritamBaza_updateCanvasAndBlock()
 
+    /* Uz graf konflikata se svako teme dodaje u vremenu srazmernom broju
+     * stranica koje se vide iz njega i promena u grafu; kako je redosled
+     * nasumican, ukupno je to O(n log n) ocekivano (de Berg i dr., gl. 11) */
+    if (_strategija == StrategijaOmotaca3D::KONFLIKTI) {
+        AlgoritamBaza_faza("konflikti");
+        PocetniKonflikti();
+    }
+
     /* Svako teme se dodaje u linearnom vremenu po
      * tekucem broju ivica. Prema lemi iz knjige, broj
      * ivica je najvise O(n). Brisanje viska je takodje
@@ -100,12 +118,23 @@ void KonveksniOmotac3D::pokreniAlgoritam()
      * petlja i samim tim ceo algoritam su reda O(n^2).
      * Pre zamene niza skupom, dodavanje temena je bilo
      * kvadratno, pa je ukupno vreme bilo reda O(n^3). */
+    AlgoritamBaza_sabiracFaze(dodavanje, "dodavanje-temena");
+    AlgoritamBaza_sabiracFaze(brisanje, "brisanje-viska");
     for(auto i=0ul; i<_tacke.size() ;i++)
     {
         if(!_tacke[i]->getObradjeno())
         {
-            DodajTeme(_tacke[i]);
-            ObrisiVisak();
+            {
+                AlgoritamBaza_deoFaze(dodavanje);
+                if (_strategija == StrategijaOmotaca3D::KONFLIKTI)
+                    DodajTemeUzKonflikte(_tacke[i]);
+                else
+                    DodajTeme(_tacke[i]);
+            }
+            {
+                AlgoritamBaza_deoFaze(brisanje);
+                ObrisiVisak();
+            }
             _tacke[i]->setObradjeno(true);
             AlgoritamBaza_updateCanvasAndBlock()
         }
@@ -133,10 +162,10 @@ bool KonveksniOmotac3D::Tetraedar()
     t3->setObradjeno(true);
 
     for(;it != _tacke.end(); it++)
-        if(static_cast<bool>(pomocneFunkcije::zapremina(t1->koordinate(),
-                                                        t2->koordinate(),
-                                                        t3->koordinate(),
-                                                        (*it)->koordinate())))
+        if(pomocneFunkcije::zapremina(t1->koordinate(),
+                                      t2->koordinate(),
+                                      t3->koordinate(),
+                                      (*it)->koordinate()) != 0)
             break;
     if(it == _tacke.end())
         return false;
@@ -144,14 +173,10 @@ bool KonveksniOmotac3D::Tetraedar()
     Teme *t4 = *it;
     t4->setObradjeno(true);
 
-    Ivica *i1 = new Ivica(t1, t2);
-    Ivica *i2 = new Ivica(t2, t3);
-    Ivica *i3 = new Ivica(t3, t1);
-    Stranica *s1 = new Stranica(t1, t2, t3);
-     _stranice.push_back(s1);
-    _ivice.insert(i1);
-    _ivice.insert(i2);
-    _ivice.insert(i3);
+    Ivica *i1 = nadjiIliNapraviIvicu(_ivice, t1, t2);
+    Ivica *i2 = nadjiIliNapraviIvicu(_ivice, t2, t3);
+    Ivica *i3 = nadjiIliNapraviIvicu(_ivice, t3, t1);
+    Stranica *s1 = _bazenStranica.napravi(t1, t2, t3);
 
     i1->postavi_stranicu(s1);
     i2->postavi_stranicu(s1);
@@ -177,9 +202,10 @@ void KonveksniOmotac3D::DodajTeme(Teme* t)
 
     /* Kroz stranice iteriramo tako sto zapravo
      * uzimamo dve po dve prolaskom kroz ivice */
-    for(auto ivica : _ivice){
+    for(const auto &par : _ivice){
+        const auto ivica = par.second;
         Stranica *s = ivica->s1();
-        float zapremina = zapremina6(s, t);
+        double zapremina = zapremina6(s, t);
 
         if(zapremina <= 0){
             vidljiva = true;
@@ -206,7 +232,11 @@ void KonveksniOmotac3D::DodajTeme(Teme* t)
      * su one po pravilu menjane (samim sobom). U kombinaciji sa preterano velikom
      * tolerancijom na numericku gresku, ovo je po pravilu vodilo ka null stranicama,
      * te SIGSEGV (segmentation fault) pri svim iole vecim ulazima (npr. preko sto) */
-    for(auto ivica: std::vector<Ivica*>(_ivice.cbegin(), _ivice.cend())){
+    std::vector<Ivica*> stareIvice;
+    stareIvice.reserve(_ivice.size());
+    for(const auto &par : _ivice)
+        stareIvice.push_back(par.second);
+    for(auto ivica: stareIvice){
         const auto s1Losa = ivica->s1()->getVidljiva();
         const auto s2Losa = ivica->s2()->getVidljiva();
         if(s1Losa && s2Losa)
@@ -218,12 +248,120 @@ void KonveksniOmotac3D::DodajTeme(Teme* t)
     }
 }
 
+void KonveksniOmotac3D::izmesajTemena()
+{
+    /* Ocekivana slozenost vazi za nasumican redosled dodavanja; seme je seme
+     * ulaza, pa je izvrsavanje ponovljivo. Menja se samo redosled u _tacke */
+    std::mt19937_64 generator(GeneratorUlaza::tekuci().seme());
+    for (auto i = _tacke.size(); i > 1; i--)
+        std::swap(_tacke[i - 1], _tacke[generator() % i]);
+}
+
+void KonveksniOmotac3D::PocetniKonflikti()
+{
+    /* Posle Tetraedar() su u bazenu tacno cetiri stranice tetraedra */
+    const auto brojStranica = static_cast<uint32_t>(_bazenStranica.brojMesta());
+    _konfliktiTemena.assign(_bazenTemena.brojMesta(), {});
+    _konfliktiStranica.assign(brojStranica, {});
+    for (auto t : _tacke) {
+        if (t->getObradjeno())
+            continue;
+        for (auto i = 0u; i < brojStranica; i++) {
+            const auto s = _bazenStranica[i];
+            if (zapremina6(s, t) < 0) {
+                _konfliktiStranica[i].push_back(t);
+                _konfliktiTemena[t->indeks()].push_back(s);
+            }
+        }
+    }
+}
+
+void KonveksniOmotac3D::DodajTemeUzKonflikte(Teme* t)
+{
+    /* Vidljive stranice su tacno one u konfliktu sa temenom, bez onih koje
+     * su u medjuvremenu obrisane. Vidljivost je stroga (zapremina < 0), jer
+     * samo za nju vazi da se nova stranica vidi samo iz temena iz kojih se
+     * vidi neka od dve stranice uz ivicu horizonta nad kojom je napravljena */
+    std::vector<Stranica*> vidljive;
+    for (auto s : _konfliktiTemena[t->indeks()])
+        if (!s->getVidljiva())
+            vidljive.push_back(s);
+    std::vector<Stranica*>().swap(_konfliktiTemena[t->indeks()]);
+    if (vidljive.empty())
+        return;
+
+    for (auto s : vidljive)
+        s->setVidljiva(true);
+
+    /* Ivice vidljivih stranica: izmedju dve vidljive se brisu, a nad ivicama
+     * horizonta se, kao u DodajTeme, prave nove stranice sa temenom */
+    for (auto s : vidljive) {
+        Teme* temena[3] = {s->t1(), s->t2(), s->t3()};
+        for (auto i = 0; i < 3; i++) {
+            Ivica* ivica = nadjiIvicu(temena[i], temena[(i + 1) % 3]);
+            const auto s1Losa = ivica->s1()->getVidljiva();
+            const auto s2Losa = ivica->s2()->getVidljiva();
+            if (s1Losa && s2Losa) {
+                if (!ivica->obrisati())
+                    _obrisaneIvice.push_back(ivica);
+                ivica->setObrisati(true);
+                continue;
+            }
+
+            Stranica* druga = s1Losa ? ivica->s2() : ivica->s1();
+            Stranica* nova = s1Losa ? napraviPrvuStranicu(ivica, t)
+                                    : napraviDruguStranicu(ivica, t);
+            ivica->zameniVidljivuStranicu(nova, s1Losa ? 0 : 1);
+            dodajKonflikte(nova, s, druga, t);
+        }
+    }
+
+    /* Obrisane stranice vise ne trebaju konflikte; temena ih preskacu */
+    for (auto s : vidljive)
+        std::vector<Teme*>().swap(_konfliktiStranica[s->indeks()]);
+}
+
+void KonveksniOmotac3D::dodajKonflikte(Stranica* nova, Stranica* stara, Stranica* druga, Teme* t)
+{
+    /* Kandidati su temena u konfliktu sa starom (vidljivom) ili drugom
+     * stranicom uz istu ivicu; teme koje je u obe se proverava jednom, jer je
+     * nova stranica tada vec poslednja u njegovim konfliktima */
+    if (_konfliktiStranica.size() <= nova->indeks())
+        _konfliktiStranica.resize(nova->indeks() + 1);
+    auto &konfliktiNove = _konfliktiStranica[nova->indeks()];
+    const auto proveri = [&](Teme* q) {
+        auto &konfliktiTemena = _konfliktiTemena[q->indeks()];
+        if (q == t || (!konfliktiTemena.empty() && konfliktiTemena.back() == nova))
+            return;
+        if (zapremina6(nova, q) < 0) {
+            konfliktiNove.push_back(q);
+            konfliktiTemena.push_back(nova);
+        }
+    };
+    for (auto q : _konfliktiStranica[stara->indeks()])
+        proveri(q);
+    for (auto q : _konfliktiStranica[druga->indeks()])
+        proveri(q);
+}
+
 void KonveksniOmotac3D::ObrisiVisak()
 {
-    std::experimental::erase_if(_ivice, [](Ivica* ivica){
-        bool rez = ivica->obrisati();
+    /* Uz graf konflikata su ivice za brisanje zapamcene, pa se ne prolazi
+     * kroz ceo skup, sto bi opet bilo O(n) po temenu */
+    if (_strategija == StrategijaOmotaca3D::KONFLIKTI) {
+        for (auto ivica : _obrisaneIvice) {
+            _ivice.erase(kljucIvice(ivica->t1(), ivica->t2()));
+            _bazenIvica.oslobodi(ivica);
+        }
+        _obrisaneIvice.clear();
+        return;
+    }
+
+    /* Mesta obrisanih ivica se vracaju u bazen za ivice narednih temena */
+    std::experimental::erase_if(_ivice, [this](const SkupIvica::value_type &par){
+        bool rez = par.second->obrisati();
         if(rez)
-            delete ivica;
+            _bazenIvica.oslobodi(par.second);
         return rez;
     });
 }
@@ -231,7 +369,7 @@ void KonveksniOmotac3D::ObrisiVisak()
 /*--------------------------------------------------------------------------------------------------*/
 /*---------------------------------Pomocni metodi---------------------------------------------------*/
 /*--------------------------------------------------------------------------------------------------*/
-float KonveksniOmotac3D::zapremina6(Stranica *s, Teme *t) const
+double KonveksniOmotac3D::zapremina6(Stranica *s, Teme *t) const
 {
     return pomocneFunkcije::zapremina(s->t1()->koordinate(),
                                       s->t2()->koordinate(),
@@ -248,34 +386,31 @@ Stranica* KonveksniOmotac3D::napraviStranicu(Teme *i1t1, Teme *i1t2,
                                              Teme *i2t1, Teme *i2t2,
                                              Teme *st1, Teme *st2, Teme *st3)
 {
-    /* Pretraga u neuredjenom skupu je u konstantnom vremenu. Pravi
-     * se zeljena ivica i zatim pronalazi fjom find. Ako je uspesno
-     * nadjena, uzima se taj pokazivac. Inace se prosiruje skup. */
-    Ivica* i1 = new Ivica(i1t1, i1t2);
-    auto iv1 = _ivice.find(i1);
-    if(iv1 != _ivice.end()){
-        delete i1;
-        i1 = *iv1;
-    } else {
-        _ivice.insert(i1);
-    }
+    /* Pretraga u hes tabeli je u konstantnom vremenu; ivica se
+     * pravi samo ako je nema */
+    Ivica* i1 = nadjiIliNapraviIvicu(_ivice, i1t1, i1t2);
+    Ivica* i2 = nadjiIliNapraviIvicu(_ivice, i2t1, i2t2);
 
-    Ivica* i2 = new Ivica(i2t1, i2t2);
-    auto iv2 = _ivice.find(i2);
-    if(iv2 != _ivice.end()){
-        delete i2;
-        i2 = *iv2;
-    } else {
-        _ivice.insert(i2);
-    }
-
-    Stranica *s = new Stranica(st1, st2, st3);
-     _stranice.push_back(s);
+    Stranica *s = _bazenStranica.napravi(st1, st2, st3);
     i1->postavi_stranicu(s);
     i2->postavi_stranicu(s);
     return s;
 }
 
+Ivica* KonveksniOmotac3D::nadjiIvicu(Teme *a, Teme *b) const
+{
+    return _ivice.find(kljucIvice(a, b))->second;
+}
+
+Ivica* KonveksniOmotac3D::nadjiIliNapraviIvicu(SkupIvica &ivice, Teme *a, Teme *b)
+{
+    /* Jedna pretraga po paru temena: nova stavka je nullptr dok se ne napravi ivica */
+    auto &ivica = ivice[kljucIvice(a, b)];
+    if (!ivica)
+        ivica = _bazenIvica.napravi(a, b);
+    return ivica;
+}
+
 Stranica* KonveksniOmotac3D::napraviPrvuStranicu(Ivica *iv, Teme *t)
 {
     return napraviStranicu(t, iv->t1(), iv->t2(), t, iv->t1(), iv->t2(), t);
@@ -309,6 +444,16 @@ void KonveksniOmotac3D::crtajStranicu(Stranica* s) const
     glEnd();
 }
 
+void KonveksniOmotac3D::crtajTrouglove() const
+{
+    /* Stranice iz geometrija::quickhull3D nemaju svoje boje, pa su sve iste */
+    glColor4d(0.2, 0.6, 1, 0.3);
+    glBegin(GL_TRIANGLES);
+        for (auto t : _trouglovi)
+            glVertex3f(_tacke[t]->x(), _tacke[t]->y(), _tacke[t]->z());
+    glEnd();
+}
+
 void KonveksniOmotac3D::crtajAlgoritam(QPainter*) const
 {
     /* Crtanje svih temena */
@@ -317,12 +462,17 @@ void KonveksniOmotac3D::crtajAlgoritam(QPainter*) const
             crtajTeme(teme);
     glEnd();
 
+    if (_strategija == StrategijaOmotaca3D::QUICKHULL) {
+        crtajTrouglove();
+        return;
+    }
+
     /* Crtanje svih stranica prolaskom
      * dve po dve kroz skup ivica */
-    for(auto ivica: _ivice)
+    for(const auto &par: _ivice)
     {
-        crtajStranicu(ivica->s1());
-        crtajStranicu(ivica->s2());
+        crtajStranicu(par.second->s1());
+        crtajStranicu(par.second->s2());
     }
 }
 
@@ -334,6 +484,22 @@ void KonveksniOmotac3D::pokreniNaivniAlgoritam()
      * konveksnom omotacu, u suprotnom ne pripada.
      * Slozenost naivnog algoritma je O(n^4). */
 
+    /* Zapremine sa svim tackama se racunaju paketnim predikatom, pa se
+     * koordinate jednom prepisuju u nizove */
+    std::vector<double> x, y, z;
+    x.reserve(_tacke.size());
+    y.reserve(_tacke.size());
+    z.reserve(_tacke.size());
+    for (auto tacka : _tacke) {
+        x.push_back(tacka->x());
+        y.push_back(tacka->y());
+        z.push_back(tacka->z());
+    }
+
+    /* Poslednja odbacena stranica; moze se jos crtati (GUI nit), pa se u
+     * bazen vraca tek kada je _tekucaStranica zameni sledeca */
+    Stranica *odbacena = nullptr;
+
     for (auto i = 0ul; i < _tacke.size(); i++) {
         for (auto j = i+1; j < _tacke.size(); j++) {
             for (auto k = j+1; k < _tacke.size(); k++) {
@@ -343,46 +509,45 @@ void KonveksniOmotac3D::pokreniNaivniAlgoritam()
                     continue;
 
                 //cuva se tekuca stranica, radi lakseg pracenja algoritma
-                _tekucaStranica = new Stranica(_tacke[i], _tacke[j], _tacke[k]);
+                _tekucaStranica = _bazenStranica.napravi(_tacke[i], _tacke[j], _tacke[k]);
+                if (odbacena) {
+                    _bazenStranica.oslobodi(odbacena);
+                    odbacena = nullptr;
+                }
 
                 AlgoritamBaza_updateCanvasAndBlock()
 
+                const double a[3] = {x[i], y[i], z[i]};
+                const double b[3] = {x[j], y[j], z[j]};
+                const double c[3] = {x[k], y[k], z[k]};
+
                 // Pronalazenje jedne nenula zapremine
-                auto zapremina = 0.f;
-                for (auto tacka : _tacke) {
-                    zapremina = zapremina6(_tekucaStranica, tacka);
-                    if (fabsf(zapremina) > EPSf)
-                        break;
-                }
+                const auto nenula = geometrija::prvaOrijentacija3D(
+                            a, b, c, x.data(), y.data(), z.data(), x.size(),
+                            geometrija::NEGATIVNA | geometrija::POZITIVNA);
                 // Ako ne postoje 4 nekomplanarne tacke zavrsava se algoritam
-                if (fabsf(zapremina) <= EPSf)
+                if (nenula == x.size())
                     return;
 
+                // Trazi se tacka sa suprotne strane
+                const auto suprotnaStrana = zapremina6(_tekucaStranica, _tacke[nenula]) > 0
+                                          ? geometrija::NEGATIVNA
+                                          : geometrija::POZITIVNA;
+                const auto prvaSuprotna = geometrija::prvaOrijentacija3D(
+                            a, b, c, x.data(), y.data(), z.data(), x.size(), suprotnaStrana);
 
-                int znakZapremine = zapremina > 0 ? 1 : -1;
-
-                auto it = _tacke.begin();
-                for (; it != _tacke.end(); it++) {
-                    zapremina = zapremina6(_tekucaStranica, *it);
-                    if (zapremina * znakZapremine < -EPSf)
-                        break;
-                }
-
-               //delete stranica;
-
-                if (it == _tacke.end()) {
+                if (prvaSuprotna == x.size()) {
                     _naivniOmotac.push_back(_tekucaStranica);
                     AlgoritamBaza_updateCanvasAndBlock()
                     /* Sve zapremine su istog znaka (dozvoljavamo da su neke i nula),
                      * pa stranica pripada konveksnom omotacu */
 
                      /*Postoji funkcija za iscrtavanje stranice*/
-                     auto *ivica1 = new Ivica(_tacke[i], _tacke[j]);
-                     auto *ivica2 = new Ivica(_tacke[i], _tacke[k]);
-                     auto *ivica3 = new Ivica(_tacke[j], _tacke[k]);
-                     _naivneIvice.insert(ivica1);
-                     _naivneIvice.insert(ivica2);
-                     _naivneIvice.insert(ivica3);
+                     nadjiIliNapraviIvicu(_naivneIvice, _tacke[i], _tacke[j]);
+                     nadjiIliNapraviIvicu(_naivneIvice, _tacke[i], _tacke[k]);
+                     nadjiIliNapraviIvicu(_naivneIvice, _tacke[j], _tacke[k]);
+                } else {
+                    odbacena = _tekucaStranica;
                 }
 
             }
@@ -415,6 +580,19 @@ const std::vector<Stranica*> &KonveksniOmotac3D::getNaivniOmotac3d() const{
     return _naivniOmotac;
 }
 
-const std::unordered_set<Ivica*, HashIvica, EqIvica> &KonveksniOmotac3D::getKonveksniOmotac3d() const{
+const SkupIvica &KonveksniOmotac3D::getKonveksniOmotac3d() const{
    return _ivice;
 }
+
+int KonveksniOmotac3D::velicinaIzlaza() const
+{
+    /* Broj temena iz Ojlerove formule za triangulisani omotac:
+     * E = 3V - 6 za ivice, odnosno F = 2V - 4 za stranice naivnog */
+    if (!_ivice.empty())
+        return static_cast<int>(_ivice.size() + 6) / 3;
+    if (!_trouglovi.empty())
+        return static_cast<int>(_trouglovi.size() / 3 + 4) / 2;
+    if (!_naivniOmotac.empty())
+        return static_cast<int>(_naivniOmotac.size() + 4) / 2;
+    return 0;
+}
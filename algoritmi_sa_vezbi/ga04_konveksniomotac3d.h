@@ -1,11 +1,19 @@
 #ifndef KONVEKSNIOMOTAC3D_H
 #define KONVEKSNIOMOTAC3D_H
 
-#include <unordered_set>
-#include <experimental/unordered_set>
+#include <experimental/unordered_map>
 
 #include "algoritambaza.h"
 #include "ga04_konveksni3dDatastructures.h"
+#include "ga_core/bazen.h"
+#include "ga_core/tacke.h"
+
+/* Algoritam kojim se gradi omotac */
+enum class StrategijaOmotaca3D {
+    INKREMENTALNI,      /* dodavanje temena jedno po jedno uz skup ivica, O(n^2) */
+    KONFLIKTI,          /* isto, u nasumicnom redosledu uz graf konflikata, O(n log n) ocekivano */
+    QUICKHULL           /* geometrija::quickhull3D, O(n log n) u proseku */
+};
 
 class KonveksniOmotac3D : public AlgoritamBaza
 {
@@ -14,7 +22,8 @@ public:
                       int pauzaKoraka,
                       const bool &naivni = false,
                       std::string imeDatoteke = "",
-                      int brojTacaka = BROJ_SLUCAJNIH_OBJEKATA);
+                      int brojTacaka = BROJ_SLUCAJNIH_OBJEKATA,
+                      StrategijaOmotaca3D strategija = StrategijaOmotaca3D::INKREMENTALNI);
     virtual ~KonveksniOmotac3D() override;
 
 public:
@@ -23,15 +32,18 @@ public:
     void pokreniNaivniAlgoritam() final;
     void crtajNaivniAlgoritam(QPainter *painter) const final;
 
-    const std::unordered_set<Ivica *, HashIvica, EqIvica> &getIvice() const;
-    const std::unordered_set<Ivica *, HashIvica, EqIvica> &getNaivneIvice() const;
+    const SkupIvica &getIvice() const;
+    const SkupIvica &getNaivneIvice() const;
 
 
     const std::vector<Stranica*> &getNaivniOmotac3d() const;
-    const std::unordered_set<Ivica*, HashIvica, EqIvica> &getKonveksniOmotac3d() const;
+    const SkupIvica &getKonveksniOmotac3d() const;
+
+    int velicinaIzlaza() const final;
 private:
     void crtajTeme(Teme* t) const;
     void crtajStranicu(Stranica* s) const;
+    void crtajTrouglove() const;
 
     /* Pomocne funkcije za generisanje konveksnog omotaca. */
     /* Glavne funkcije. */
@@ -39,31 +51,60 @@ private:
     void DodajTeme(Teme* t);
     void ObrisiVisak();
 
+    /* Graf konflikata: nasumican redosled temena, konflikti sa tetraedrom,
+     * pa dodavanje temena koje obilazi samo stranice vidljive iz njega */
+    void izmesajTemena();
+    void PocetniKonflikti();
+    void DodajTemeUzKonflikte(Teme* t);
+    void dodajKonflikte(Stranica* nova, Stranica* stara, Stranica* druga, Teme* t);
+
     /* Pomocne funkcije. */
-    float zapremina6(Stranica* s, Teme* t) const;
+    double zapremina6(Stranica* s, Teme* t) const;
     bool kolinearne(Teme* a, Teme* b, Teme* c) const;
     Stranica* napraviStranicu(Teme *i1t1, Teme *i1t2,
                               Teme *i2t1, Teme *i2t2,
                               Teme *st1, Teme *st2, Teme *st3);
     Stranica* napraviDruguStranicu(Ivica* iv, Teme* t);
     Stranica* napraviPrvuStranicu(Ivica* iv, Teme* t);
+    Ivica* nadjiIvicu(Teme* a, Teme* b) const;
+    Ivica* nadjiIliNapraviIvicu(SkupIvica &ivice, Teme* a, Teme* b);
     /* Ucitavanje podataka. */
-    std::vector<Teme*> generisiNasumicneTacke(int brojTacaka = BROJ_SLUCAJNIH_OBJEKATA) const;
-    std::vector<Teme*> ucitajPodatkeIzDatoteke(std::string imeDatoteke) const;
+    std::vector<Teme*> generisiNasumicneTacke(int brojTacaka = BROJ_SLUCAJNIH_OBJEKATA);
+    std::vector<Teme*> ucitajPodatkeIzDatoteke(std::string imeDatoteke);
+
+    /* Svi objekti omotaca (i naivnog) su u bazenima, pa se ne prave i ne
+     * brisu jedan po jedan; oslobadjaju se zajedno sa omotacem */
+    geometrija::Bazen<Teme> _bazenTemena;
+    geometrija::Bazen<Ivica> _bazenIvica;
+    geometrija::Bazen<Stranica> _bazenStranica;
 
     std::vector<Teme*> _tacke;
 
-    /* Neuredjeni skup za cuvanje ivica; nije nam sustinski vazan redosled
-     * ivica u skupu, pa nema potrebe za nizovima kod kojih su pretraga i
+    StrategijaOmotaca3D _strategija;
+
+    /* Koordinate temena kao nizovi za geometrija::quickhull3D, i njegov izlaz:
+     * po tri indeksa u _tacke za svaku stranicu */
+    geometrija::Tacke3D<double> _koordinate;
+    std::vector<uint32_t> _trouglovi;
+
+    /* Hes tabela ivica po paru temena; nije nam sustinski vazan redosled
+     * ivica, pa nema potrebe za nizovima kod kojih su pretraga i
      * brisanje reda O(n) umesto jednostavnog O(1) u proseku */
-    std::unordered_set<Ivica*, HashIvica, EqIvica> _ivice;
-    std::unordered_set<Ivica*, HashIvica, EqIvica> _naivneIvice;
+    SkupIvica _ivice;
+    SkupIvica _naivneIvice;
+
+    /* Ivice oznacene za brisanje pri dodavanju temena uz graf konflikata */
+    std::vector<Ivica*> _obrisaneIvice;
+
+    /* Graf konflikata, po indeksima temena i stranica u bazenima: stranice
+     * vidljive iz neobradjenog temena (medju njima i vec obrisane, koje se
+     * preskacu pri citanju) i neobradjena temena iz kojih se stranica vidi */
+    std::vector<std::vector<Stranica*>> _konfliktiTemena;
+    std::vector<std::vector<Teme*>> _konfliktiStranica;
 
     Stranica* _tekucaStranica = nullptr;
     //vektor stranica
     std::vector<Stranica*> _naivniOmotac;
-    // ovaj vektor je potreban kako bi se memorija uredno oslobodila
-    std::vector<Stranica*> _stranice;
 };
 
 #endif // KONVEKSNIOMOTAC3D_H
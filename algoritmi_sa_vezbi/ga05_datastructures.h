@@ -41,15 +41,10 @@ struct poredjenjeDuzi {
     {}
 
     bool operator()(const QLineF *duz1, const QLineF *duz2) const {
-        QLineF brisucaPrava( 0, *yBrisucaPrava-0.5,
-                            10, *yBrisucaPrava-0.5);
-
-        QPointF presek1;
-        QPointF presek2;
-        pomocneFunkcije::presekDuzi(*duz1, brisucaPrava, presek1);
-        pomocneFunkcije::presekDuzi(*duz2, brisucaPrava, presek2);
-
-        return presek1.x() < presek2.x();
+        /* Poredi se x preseka sa brisucom pravom, malo ispod njene visine */
+        const double y = *yBrisucaPrava - 0.5;
+        return geometrija::xNaVisini(pomocneFunkcije::uDuz(*duz1), y)
+             < geometrija::xNaVisini(pomocneFunkcije::uDuz(*duz2), y);
     }
 };
 
@@ -1,4 +1,5 @@
 #include "ga05_preseciduzi.h"
+#include "generatorulaza.h"
 
 #include <fstream>
 
@@ -22,15 +23,23 @@ void PreseciDuzi::pokreniAlgoritam()
 {
     /* Slozenost ovakvog algoritma: O(nlogn + klogn).
      * Izlazni parametar k je broj preseka. */
-    for (auto &duz : _duzi) {
-        _redDogadjaja.emplace(duz.p1(), tipDogadjaja::POCETAK_DUZI, &duz, nullptr);
-        _redDogadjaja.emplace(duz.p2(), tipDogadjaja::KRAJ_DUZI, &duz, nullptr);
+    {
+        AlgoritamBaza_faza("red-dogadjaja");
+        for (auto &duz : _duzi) {
+            _redDogadjaja.emplace(duz.p1(), tipDogadjaja::POCETAK_DUZI, &duz, nullptr);
+            _redDogadjaja.emplace(duz.p2(), tipDogadjaja::KRAJ_DUZI, &duz, nullptr);
+        }
     }
 
+    /* Obrada dogadjaja se meri jednom, oko cele petlje: merenje po
+     * dogadjaju bi bilo znatan deo posla jednog dogadjaja */
+    AlgoritamBaza_faza("obrada-dogadjaja");
     while (!_redDogadjaja.empty()) {
         auto td = *_redDogadjaja.begin();
         _redDogadjaja.erase(_redDogadjaja.begin());
 
+        /* Azuriranje statusa, zajedno sa proverom preseka susednih
+         * duzi i dodavanjem novih dogadjaja preseka */
         _brisucaPravaY = td.tacka.y();
         if (td.tip == tipDogadjaja::POCETAK_DUZI) {
             AlgoritamBaza_updateCanvasAndBlock()
@@ -172,16 +181,38 @@ void PreseciDuzi::pokreniNaivniAlgoritam()
 {
     /* Slozenost naivnog algoritma: O(n^2). Ona je
      * asimptotski optimalna za najgori slucaj. */
-    QPointF presek;
-    for (_i = 0; _i < _duzi.size(); _i++) {
-        for (_j = _i+1; _j < _duzi.size(); _j++) {
-            if (pomocneFunkcije::presekDuzi(_duzi[_i],
-                                            _duzi[_j],
-                                            presek))
-                _naivniPreseci.push_back(presek);
+    if (!_pCrtanje) {
+        /* Bez animacije se svaka duz proverava paketno protiv svih sledecih,
+         * a tacka preseka se racuna samo za parove koji se seku */
+        geometrija::NizDuzi duzi;
+        duzi.reserve(_duzi.size());
+        for (const auto &duz : _duzi)
+            duzi.push_back(pomocneFunkcije::uDuz(duz));
+
+        std::vector<uint32_t> indeksi;
+        for (_i = 0; _i < _duzi.size(); _i++) {
+            const auto duz = duzi[_i];
+            geometrija::duziKojeSeku(duz, duzi, _i+1, indeksi);
+            for (auto j : indeksi) {
+                double x, y;
+                if (geometrija::tackaPreseka(duz, duzi[j], x, y))
+                    _naivniPreseci.emplace_back(x, y);
+            }
             AlgoritamBaza_updateCanvasAndBlock()
         }
     }
+    else {
+        QPointF presek;
+        for (_i = 0; _i < _duzi.size(); _i++) {
+            for (_j = _i+1; _j < _duzi.size(); _j++) {
+                if (pomocneFunkcije::presekDuzi(_duzi[_i],
+                                                _duzi[_j],
+                                                presek))
+                    _naivniPreseci.push_back(presek);
+                AlgoritamBaza_updateCanvasAndBlock()
+            }
+        }
+    }
     AlgoritamBaza_updateCanvasAndBlock()
     emit animacijaZavrsila();
 }
@@ -249,25 +280,36 @@ void PreseciDuzi::crtajNaivniAlgoritam(QPainter *painter) const
 
 std::vector<QLineF> PreseciDuzi::generisiNasumicneDuzi(int brojDuzi) const
 {
-    srand(static_cast<unsigned>(time(nullptr)));
+    static int constexpr DRAWING_BORDER = 10;
+
+    int xMax;
+    int yMax;
+
+    if (_pCrtanje)
+    {
+        xMax = _pCrtanje->width() - DRAWING_BORDER;
+        yMax = _pCrtanje->height() - DRAWING_BORDER;
+    }
+    else
+    {
+        /* Bez oblasti crtanja (merenje) oblast raste sa brojem objekata */
+        xMax = yMax = GeneratorUlaza::stranicaOblasti(brojDuzi, GeneratorUlaza::tekuci().raspodela());
+    }
 
     std::vector<QLineF> randomDuzi;
 
-    std::vector<QPoint> tacke_za_duzi = generisiNasumicneTacke(2*brojDuzi);
+    const auto duzi = GeneratorUlaza::tekuci().duzi(brojDuzi, DRAWING_BORDER, xMax-1,
+                                                    DRAWING_BORDER, yMax-1, true);
 
-    for(auto i=0ul; i < tacke_za_duzi.size()-1; i+=2){
-        auto x1 = tacke_za_duzi[i].x();
-        auto x2 = tacke_za_duzi[i+1].x();
-        auto y1 = tacke_za_duzi[i].y();
-        auto y2 = tacke_za_duzi[i+1].y();
+    for (const auto &duz : duzi) {
+        auto x1 = duz.p1.x;
+        auto x2 = duz.p2.x;
+        auto y1 = duz.p1.y;
+        auto y2 = duz.p2.y;
 
         if (y1 < y2 || (y1 == y2 && x2 < x1)) {
-            auto tmp_y = y1;
-            auto tmp_x = x1;
-            y1 = y2;
-            x1 = x2;
-            y2 = tmp_y;
-            x2 = tmp_x;
+            std::swap(x1, x2);
+            std::swap(y1, y2);
         }
         randomDuzi.emplace_back(x1, y1, x2, y2);
     }
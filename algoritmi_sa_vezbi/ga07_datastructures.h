@@ -13,7 +13,7 @@ struct EventQueueCompTriangulation
     bool operator()(const Vertex* levi, const Vertex* desni) const
     {
         return ((levi->coordinates().y() > desni->coordinates().y())
-       || ((fabs(levi->coordinates().y()-desni->coordinates().y())<EPS)
+       || ((levi->coordinates().y() == desni->coordinates().y())
             && (levi->coordinates().x()<desni->coordinates().x())));
     }
 };
@@ -35,18 +35,16 @@ public:
 
     bool operator()(const HalfEdge* line1, const HalfEdge* line2) const
     {
-       QPointF presek1;
-       QPointF presek2;
-
-       QLineF line11(line1->origin()->coordinates(), line1->twin()->origin()->coordinates());
-       QLineF line22(line2->origin()->coordinates(), line2->twin()->origin()->coordinates());
-
-       QLineF brisucaPrava(0, *yBrisucaPrava, 100, *yBrisucaPrava);
-
-       pomocneFunkcije::presekDuzi(line11, brisucaPrava, presek1);
-       pomocneFunkcije::presekDuzi(line22, brisucaPrava, presek2);
+       return geometrija::xNaVisini(duz(line1), *yBrisucaPrava)
+            < geometrija::xNaVisini(duz(line2), *yBrisucaPrava);
+    }
 
-       return presek1.x() < presek2.x();
+private:
+    static geometrija::Duz duz(const HalfEdge* line)
+    {
+       const auto &p1 = line->origin()->coordinates();
+       const auto &p2 = line->twin()->origin()->coordinates();
+       return {p1.x(), p1.y(), p2.x(), p2.y()};
     }
 };
 
@@ -1,5 +1,6 @@
 #include "ga07_triangulation.h"
 #include "pomocnefunkcije.h"
+#include "generatorulaza.h"
 #include <fstream>
 
 Triangulation::Triangulation(QWidget *pCrtanje,
@@ -405,7 +406,6 @@ std::vector<QPointF> Triangulation::generisiNasumicneTacke(int brojTacaka) const
 {
     static int constexpr DRAWING_BORDER = 10;
 
-    srand(static_cast<unsigned>(time(nullptr)));
     int xMax;
     int yMax;
 
@@ -416,8 +416,8 @@ std::vector<QPointF> Triangulation::generisiNasumicneTacke(int brojTacaka) const
     }
     else
     {
-        xMax = CANVAS_WIDTH;
-        yMax = CANVAS_HEIGHT;
+        /* Bez oblasti crtanja (merenje) oblast raste sa brojem objekata */
+        xMax = yMax = GeneratorUlaza::stranicaOblasti(brojTacaka, GeneratorUlaza::tekuci().raspodela());
     }
 
     int xMin = DRAWING_BORDER;
@@ -425,10 +425,8 @@ std::vector<QPointF> Triangulation::generisiNasumicneTacke(int brojTacaka) const
 
     std::vector<QPointF> randomPoints;
 
-    int xDiff = xMax-xMin;
-    int yDiff = yMax-yMin;
-    for(int i=0; i < brojTacaka; i++)
-        randomPoints.emplace_back(xMin + rand()%xDiff, yMin + rand()%yDiff);
+    for (const auto &t : GeneratorUlaza::tekuci().tacke2D(brojTacaka, xMin, xMax-1, yMin, yMax-1, true))
+        randomPoints.emplace_back(t.x, t.y);
 
     return randomPoints;
 }
@@ -441,7 +439,7 @@ std::vector<QPointF> Triangulation::ucitajNasumicneTacke(int brojTacaka) const
 
     for (auto i = 1ul; i < tacke.size(); i++) {
         if (tacke[i].x() > maxTacka.x() ||
-           (fabs(tacke[i].x() - maxTacka.x()) < EPS && tacke[i].y() < maxTacka.y()))
+           (tacke[i].x() == maxTacka.x() && tacke[i].y() < maxTacka.y()))
             maxTacka = tacke[i];
     }
 
@@ -4,22 +4,46 @@
 //#define SKIP_OPTIMAL
 //#define SKIP_NAIVE
 
-// Measurement testing params
+// Measurement testing params (podrazumevani opseg; menja se iz GUI-ja i ga_bench-a)
 #define MIN_DIM                  (3)
 #define STEP                     (100)
 #define MAX_DIM                  (1003)
+#define NAJVECA_VELICINA         (10000000)
+#define BROJ_ZAGREVANJA          (1)
+#define BROJ_PONAVLJANJA         (5)
+
+// Najduze jedno izvrsavanje varijante (u sekundama); varijanta koja ga prekoraci
+// se ne meri za vece ulaze
+#define BUDZET_IZVRSAVANJA       (10.0)
+
+// Dozvoljeno usporenje medijane u odnosu na sacuvanu osnovu (0.1 = 10%)
+#define PRAG_REGRESIJE           (0.1)
+
+// Merenje trajanja faza algoritama (AlgoritamBaza_faza). U release prevodjenju
+// (QT_NO_DEBUG) se potpuno uklanja, osim ako se MERENJE_FAZA ne definise eksplicitno.
+#if !defined(QT_NO_DEBUG) && !defined(MERENJE_FAZA)
+#define MERENJE_FAZA
+#endif
 
 // Axes params
 #define Y_MAX_VAL                (1)
-#define X_MAX_VAL                (MAX_DIM)
 
-// Velicina kanvasa
-#define CANVAS_WIDTH             (MAX_DIM)
-#define CANVAS_HEIGHT            (MAX_DIM)
+// Ose su logaritamske kada je najveca velicina bar ovoliko puta veca od najmanje
+#define ODNOS_LOG_OSA            (1000)
+
+// Velicina kanvasa; bez oblasti crtanja je to najmanja oblast nasumicnih ulaza
+// (GeneratorUlaza::stranicaOblasti)
+#define CANVAS_WIDTH             (1003)
+#define CANVAS_HEIGHT            (1003)
 
 #define BROJ_SLUCAJNIH_OBJEKATA  (20)
 #define DUZINA_PAUZE             (500)
 
+// Tip koordinata u celobrojnim predikatima konveksnog omotaca (int32_t ili int64_t).
+// Sa int32_t su predikati tacni za koordinate do 2^30; int64_t (medjurezultati
+// __int128) je potreban tek za vece koordinate i sporiji je.
+#define KOORDINATA_OMOTACA       int32_t
+
 /* Ne prevelika tolerancija na numericku gresku */
 #define EPS                      (1e-6)
 #define EPSf                     (1e-6f)
@@ -0,0 +1,19 @@
+# Merenje performansi algoritama iz komandne linije, bez GUI-ja i X servera.
+# Algoritmi se prave sa oblascu crtanja nullptr, pa se ne animiraju.
+QT       += core gui opengl
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+LIBS += -lglut -lGLU
+CONFIG += c++14 console
+CONFIG -= app_bundle
+
+TARGET = ga_bench
+
+# Raspodela vremena po fazama u release prevodjenju se ukljucuje sa
+# qmake CONFIG+=faze; bez toga merenje faza nije deo izmerenog vremena
+faze: DEFINES += MERENJE_FAZA
+
+include(../algoritmi.pri)
+
+SOURCES += \
+    main.cpp
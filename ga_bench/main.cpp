@@ -0,0 +1,538 @@
+/* ga_bench - merenje performansi algoritama iz komandne linije.
+ *
+ * Primer:
+ *   ga_bench --algoritam konveksni_omotac --min 1000 --max 100000 --korak 1000 \
+ *            --ponavljanja 5 --seme 42
+ *   ga_bench --algoritam konveksni_omotac --min 1000 --max 10000000 --faktor 10
+ *
+ * Za svaku velicinu ulaza ispisuje se red sa statistikom ponovljenih merenja
+ * (min, medijana, p90, p99, standardna devijacija, u sekundama) za optimalni
+ * i naivni algoritam. Za vezivanje za izolovano jezgro koristiti --jezgro
+ * (ili taskset).
+ *
+ * Rezultati se mogu sacuvati (--json, --csv) i porediti sa ranije sacuvanom
+ * osnovom (--osnova): velicine na kojima je medijana sporija od osnove za
+ * vise od --prag se ispisuju, a program se tada zavrsava sa kodom 2.
+ *
+ * Sa --datoteka se ne meri niz velicina, vec se racuna omotac binarne datoteke
+ * tacaka deo po deo (geometrija::omotacDatoteke) i ispisuju se vreme i vrh
+ * memorije; --generisi N pre toga upisuje N nasumicnih tacaka u datoteku:
+ *   ga_bench --datoteka tacke.bin --generisi 1000000000 --deo 1048576
+ *
+ * Sa --paket M velicine ulaza su brojevi skupova od po M tacaka, a porede se
+ * jedan KonveksniOmotac po skupu i geometrija::paketniOmotaci za sve skupove,
+ * u jednoj niti i u --niti niti:
+ *   ga_bench --paket 32 --min 1000 --max 100000 --faktor 10 */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "algoritmi_sa_vezbi/ga03_konveksniomotac.h"
+#include "generatorulaza.h"
+#include "merenje.h"
+#include "pracenjealokacija.h"
+#include "ga_core/paketnipredikati.h"
+#include "ga_core/spoljniomotac2d.h"
+#include "rezultatimerenja.h"
+#include "tipalgoritma.h"
+
+namespace {
+
+struct Parametri {
+    std::string algoritam;
+    merenje::OpsegVelicina opseg;
+    merenje::ParametriMerenja merenje;
+    uint64_t seme = 1;
+    int jezgro = -1;
+    bool naivni = true;
+    bool ubrzanje = false;
+    std::string datoteka;
+    long long generisi = 0;
+    size_t tacakaPoDelu = geometrija::TACAKA_PO_DELU;
+    int tacakaPoSkupu = 0;
+    std::string json;
+    std::string csv;
+    std::string osnova;
+    double prag = PRAG_REGRESIJE;
+};
+
+/* Stranica oblasti tacaka svakog skupa sa --paket */
+const int STRANICA_PAKETA = 1 << 20;
+
+/* Izlazni kod kada je neka velicina sporija od osnove */
+const int KOD_REGRESIJE = 2;
+
+void ispisiUpotrebu(const char *program)
+{
+    std::cerr << "Upotreba: " << program << " --algoritam IME [opcije]\n"
+              << "  --min N            najmanja velicina ulaza (podrazumevano " << MIN_DIM << ")\n"
+              << "  --max N            najveca velicina ulaza, najvise " << NAJVECA_VELICINA
+              << " (podrazumevano " << MAX_DIM << ")\n"
+              << "  --korak N          korak velicine ulaza (podrazumevano " << STEP << ")\n"
+              << "  --faktor F         geometrijski niz velicina (npr. 2 ili 10) umesto koraka\n"
+              << "  --ponavljanja N    broj merenja po velicini (podrazumevano " << BROJ_PONAVLJANJA << ")\n"
+              << "  --zagrevanja N     broj zagrevanja pre merenja (podrazumevano " << BROJ_ZAGREVANJA << ")\n"
+              << "  --seme N           64-bitno seme za nasumicne ulaze (podrazumevano 1)\n"
+              << "  --raspodela IME    raspodela ulaza (podrazumevano uniformna_kvadrat)\n"
+              << "  --jezgro N         vezivanje procesa za jezgro N (samo Linux)\n"
+              << "  --budzet S         najduze jedno izvrsavanje u sekundama, 0 bez ogranicenja (podrazumevano "
+              << BUDZET_IZVRSAVANJA << ")\n"
+              << "  --bez-naivnog      ne meri se naivni algoritam\n"
+              << "  --bez-alokacija    ne prate se alokacije i vrh memorije\n"
+              << "  --odbacivanje      konveksni omotac: odbacivanje unutrasnjih tacaka pre algoritma\n"
+              << "  --niti N           konveksni omotac: broj niti paralelnog omotaca (podrazumevano broj jezgara)\n"
+              << "  --ubrzanje         meri se optimalni algoritam sa 1, 2, 4, ... niti do --niti\n"
+              << "  --strategija IME   algoritam omotaca sa --datoteka (podrazumevano grem)\n"
+              << "  --datoteka IME     omotac binarne datoteke tacaka, deo po deo, umesto niza velicina\n"
+              << "  --generisi N       upis N nasumicnih tacaka u --datoteka pre racunanja omotaca\n"
+              << "  --deo N            broj tacaka u delu datoteke (podrazumevano " << geometrija::TACAKA_PO_DELU << ")\n"
+              << "  --paket M          poredjenje omotaca skupova od M tacaka: objekat po skupu i paketniOmotaci\n"
+              << "                     (monotoni lanac bez odbacivanja; paket u 1 i u --niti niti)\n"
+              << "  --json DATOTEKA    cuvanje rezultata u JSON formatu\n"
+              << "  --csv DATOTEKA     cuvanje rezultata u CSV formatu\n"
+              << "  --osnova DATOTEKA  poredjenje sa osnovom sacuvanom sa --csv\n"
+              << "  --prag P           dozvoljeno usporenje u odnosu na osnovu (podrazumevano "
+              << PRAG_REGRESIJE << ")\n"
+              << "Algoritmi:";
+    for (const auto &a : merenje::imenaAlgoritama())
+        std::cerr << ' ' << a.ime;
+    std::cerr << "\nRaspodele:";
+    for (int i = 0; i < static_cast<int>(Raspodela::BROJ_RASPODELA); i++)
+        std::cerr << ' ' << imeRaspodele(static_cast<Raspodela>(i));
+    std::cerr << std::endl;
+}
+
+bool procitajParametre(int argc, char *argv[], Parametri &p)
+{
+    for (int i = 1; i < argc; i++) {
+        const std::string opcija = argv[i];
+        if (opcija == "--bez-naivnog") {
+            p.naivni = false;
+            continue;
+        }
+        if (opcija == "--bez-alokacija") {
+            p.merenje.pratiAlokacije = false;
+            continue;
+        }
+        if (opcija == "--odbacivanje") {
+            p.merenje.omotac.odbacivanjeUnutrasnjih = true;
+            continue;
+        }
+        if (opcija == "--ubrzanje") {
+            p.ubrzanje = true;
+            continue;
+        }
+
+        /* Sve ostale opcije imaju vrednost */
+        if (i + 1 >= argc)
+            return false;
+        const char *vrednost = argv[++i];
+
+        if (opcija == "--algoritam")
+            p.algoritam = vrednost;
+        else if (opcija == "--min")
+            p.opseg.min = std::atoi(vrednost);
+        else if (opcija == "--max")
+            p.opseg.max = std::atoi(vrednost);
+        else if (opcija == "--korak")
+            p.opseg.korak = std::atoi(vrednost);
+        else if (opcija == "--faktor")
+            p.opseg.faktor = std::atof(vrednost);
+        else if (opcija == "--ponavljanja")
+            p.merenje.ponavljanja = std::atoi(vrednost);
+        else if (opcija == "--zagrevanja")
+            p.merenje.zagrevanja = std::atoi(vrednost);
+        else if (opcija == "--seme")
+            p.seme = std::strtoull(vrednost, nullptr, 10);
+        else if (opcija == "--raspodela") {
+            if (!raspodelaIzImena(vrednost, p.merenje.raspodela))
+                return false;
+        }
+        else if (opcija == "--budzet")
+            p.merenje.budzet = std::atof(vrednost);
+        else if (opcija == "--niti")
+            p.merenje.omotac.brojNiti = static_cast<unsigned>(std::atoi(vrednost));
+        else if (opcija == "--strategija") {
+            if (!geometrija::strategijaIzImena(vrednost, p.merenje.omotac.strategija))
+                return false;
+        }
+        else if (opcija == "--datoteka")
+            p.datoteka = vrednost;
+        else if (opcija == "--generisi")
+            p.generisi = std::atoll(vrednost);
+        else if (opcija == "--deo")
+            p.tacakaPoDelu = static_cast<size_t>(std::atoll(vrednost));
+        else if (opcija == "--paket")
+            p.tacakaPoSkupu = std::atoi(vrednost);
+        else if (opcija == "--jezgro")
+            p.jezgro = std::atoi(vrednost);
+        else if (opcija == "--json")
+            p.json = vrednost;
+        else if (opcija == "--csv")
+            p.csv = vrednost;
+        else if (opcija == "--osnova")
+            p.osnova = vrednost;
+        else if (opcija == "--prag")
+            p.prag = std::atof(vrednost);
+        else
+            return false;
+    }
+
+    /* Omotac datoteke i paketni omotaci ne mere algoritam iz spiska */
+    if (!p.datoteka.empty())
+        return p.generisi >= 0 && p.tacakaPoDelu > 0 &&
+               p.tacakaPoDelu <= static_cast<size_t>(std::numeric_limits<int>::max());
+
+    if (p.tacakaPoSkupu > 0 && p.algoritam.empty())
+        p.algoritam = "konveksni_omotac";
+
+    return !p.algoritam.empty() && p.opseg.ispravan() && p.merenje.ponavljanja > 0 && p.merenje.zagrevanja >= 0 &&
+           p.merenje.budzet >= 0 &&
+           p.prag >= 0;
+}
+
+bool nadjiAlgoritam(const std::string &ime, TipAlgoritma &tip)
+{
+    for (const auto &a : merenje::imenaAlgoritama()) {
+        if (ime == a.ime) {
+            tip = a.tip;
+            return true;
+        }
+    }
+    return false;
+}
+
+merenje::RezultatMerenja napraviRezultat(const Parametri &p, const char *varijanta, int n, uint64_t seme,
+                                         const merenje::StatistikaMerenja &statistika)
+{
+    merenje::RezultatMerenja r;
+    r.algoritam = p.algoritam;
+    r.varijanta = varijanta;
+    r.brojObjekata = n;
+    r.seme = seme;
+    r.raspodela = imeRaspodele(p.merenje.raspodela);
+    r.oblast = GeneratorUlaza::stranicaOblasti(n, p.merenje.raspodela);
+    r.revizija = merenje::revizijaKoda();
+    r.statistika = statistika;
+    return r;
+}
+
+void ispisiStatistiku(const merenje::StatistikaMerenja &s)
+{
+    std::cout << '\t' << s.min << '\t' << s.medijana << '\t' << s.p90
+              << '\t' << s.p99 << '\t' << s.standardnaDevijacija;
+}
+
+/* Optimalni i naivni algoritam za svaku velicinu ulaza, uz procenu slozenosti */
+std::vector<merenje::RezultatMerenja> meriVelicine(const Parametri &p, TipAlgoritma tip)
+{
+    std::cout << "# n\tseme\topt_min\topt_med\topt_p90\topt_p99\topt_sd"
+              << "\tnaiv_min\tnaiv_med\tnaiv_p90\tnaiv_p99\tnaiv_sd" << std::endl;
+
+    /* Varijanta koja prekoraci budzet se ne meri za vece ulaze */
+    bool meriOptimalni = true;
+    bool meriNaivni = p.naivni;
+
+    std::vector<merenje::RezultatMerenja> rezultati;
+    for (int n : p.opseg.velicine()) {
+        if (!meriOptimalni && !meriNaivni)
+            break;
+
+        /* Optimalni i naivni algoritam se mere nad istim ulazima */
+        const auto seme = merenje::semeZaVelicinu(p.seme, n);
+
+        const auto optimalni = meriOptimalni ? merenje::izmeri(tip, n, false, p.merenje, seme)
+                                             : merenje::StatistikaMerenja();
+        const auto naivni = meriNaivni ? merenje::izmeri(tip, n, true, p.merenje, seme)
+                                       : merenje::StatistikaMerenja();
+
+        if (meriOptimalni)
+            rezultati.push_back(napraviRezultat(p, "optimalni", n, seme, optimalni));
+        if (meriNaivni)
+            rezultati.push_back(napraviRezultat(p, "naivni", n, seme, naivni));
+        meriOptimalni = meriOptimalni && !optimalni.prekoraceno;
+        meriNaivni = meriNaivni && !naivni.prekoraceno;
+
+        std::cout << n << '\t' << seme;
+        ispisiStatistiku(optimalni);
+        ispisiStatistiku(naivni);
+        std::cout << std::endl;
+
+        /* Raspodela po fazama kao komentar, da ne smeta obradi kolona */
+        if (optimalni.velicinaIzlaza > 0)
+            std::cout << "#   h = " << optimalni.velicinaIzlaza << ", oblast = "
+                      << GeneratorUlaza::stranicaOblasti(n, p.merenje.raspodela) << std::endl;
+        if (optimalni.prekoraceno)
+            std::cout << "#   optimalni: prekoracen budzet, ne meri se za vece ulaze" << std::endl;
+        if (naivni.prekoraceno)
+            std::cout << "#   naivni: prekoracen budzet, ne meri se za vece ulaze" << std::endl;
+        if (!optimalni.faze.empty())
+            std::cout << "#   optimalni: " << merenje::opisFaza(optimalni) << std::endl;
+        if (!naivni.faze.empty())
+            std::cout << "#   naivni: " << merenje::opisFaza(naivni) << std::endl;
+        if (optimalni.brojaci.dostupni)
+            std::cout << "#   optimalni: " << optimalni.brojaci.opis() << std::endl;
+        if (naivni.brojaci.dostupni)
+            std::cout << "#   naivni: " << naivni.brojaci.opis() << std::endl;
+        if (optimalni.alokacije.dostupno)
+            std::cout << "#   optimalni: " << optimalni.alokacije.opis(n) << std::endl;
+        if (naivni.alokacije.dostupno)
+            std::cout << "#   naivni: " << naivni.alokacije.opis(n) << std::endl;
+    }
+
+    /* Procena slozenosti svake varijante iz medijana svih velicina */
+    for (const char *varijanta : {"optimalni", "naivni"}) {
+        for (const auto &r : rezultati) {
+            if (r.varijanta == varijanta) {
+                std::cout << "# slozenost, " << varijanta << ": "
+                          << merenje::proceniSlozenost(rezultati, r).opis() << std::endl;
+                break;
+            }
+        }
+    }
+
+    return rezultati;
+}
+
+/* Optimalni algoritam sa 1, 2, 4, ... niti (ParametriOmotaca::brojNiti), do --niti
+ * ili broja jezgara; ubrzanje je odnos medijane jedne niti i medijane sa k niti */
+std::vector<merenje::RezultatMerenja> meriUbrzanje(const Parametri &p, TipAlgoritma tip)
+{
+    const unsigned najvise = p.merenje.omotac.brojNiti ? p.merenje.omotac.brojNiti
+                                                       : std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> niti;
+    for (unsigned k = 1; k < najvise; k *= 2)
+        niti.push_back(k);
+    niti.push_back(najvise);
+
+    std::cout << "# n\tseme\tniti\tmin\tmedijana\tp90\tubrzanje" << std::endl;
+
+    std::vector<merenje::RezultatMerenja> rezultati;
+    for (int n : p.opseg.velicine()) {
+        const auto seme = merenje::semeZaVelicinu(p.seme, n);
+
+        bool prekoraceno = false;
+        double jednaNit = 0;
+        for (auto k : niti) {
+            auto parametri = p.merenje;
+            parametri.omotac.brojNiti = k;
+            const auto s = merenje::izmeri(tip, n, false, parametri, seme);
+            if (s.prekoraceno) {
+                std::cout << "#   " << k << " niti: prekoracen budzet, ne meri se za vece ulaze" << std::endl;
+                prekoraceno = true;
+                break;
+            }
+
+            if (k == 1)
+                jednaNit = s.medijana;
+            const auto varijanta = "niti_" + std::to_string(k);
+            rezultati.push_back(napraviRezultat(p, varijanta.c_str(), n, seme, s));
+            std::cout << n << '\t' << seme << '\t' << k << '\t' << s.min << '\t' << s.medijana
+                      << '\t' << s.p90 << '\t' << (s.medijana > 0 ? jednaNit / s.medijana : 0) << std::endl;
+        }
+        if (prekoraceno)
+            break;
+    }
+    return rezultati;
+}
+
+/* Skupovi od po --paket tacaka (n je broj skupova): jedan KonveksniOmotac po
+ * skupu, sa svojim QObject-om i nizovima, prema paketniOmotaci nad svim
+ * skupovima odjednom. Obe strane racunaju monotoni lanac bez odbacivanja, pa
+ * je razlika u jednoj niti trosak po objektu; paket u vise niti meri jos i
+ * paralelizam. Ulazi se prave pre merenja i nisu deo izmerenog vremena. */
+std::vector<merenje::RezultatMerenja> meriPaket(const Parametri &p)
+{
+    using Koordinata = KonveksniOmotac::Koordinata;
+    const int m = p.tacakaPoSkupu;
+    const unsigned niti = p.merenje.omotac.brojNiti ? p.merenje.omotac.brojNiti
+                                                    : std::max(1u, std::thread::hardware_concurrency());
+
+    geometrija::ParametriOmotaca poObjektu;
+    poObjektu.strategija = geometrija::StrategijaOmotaca::MONOTONI_LANAC;
+
+    std::cout << "# n\tseme\ttacaka_po_skupu\tniti\tobjekti_med\tpaket_1_med\tpaket_niti_med"
+              << "\tubrzanje_paketa\tubrzanje_niti" << std::endl;
+
+    std::vector<merenje::RezultatMerenja> rezultati;
+    for (int n : p.opseg.velicine()) {
+        const auto seme = merenje::semeZaVelicinu(p.seme, n);
+        GeneratorUlaza generator(seme, p.merenje.raspodela);
+
+        std::vector<std::vector<QPoint>> skupovi(n);
+        geometrija::Tacke2D<Koordinata> tacke;
+        std::vector<uint32_t> pocetak(1, 0);
+        tacke.reserve(static_cast<size_t>(n) * m);
+        for (auto &skup : skupovi) {
+            for (const auto &t : generator.tacke2D(m, 0, STRANICA_PAKETA, 0, STRANICA_PAKETA, true)) {
+                skup.emplace_back(static_cast<int>(t.x), static_cast<int>(t.y));
+                tacke.push_back(static_cast<Koordinata>(t.x), static_cast<Koordinata>(t.y));
+            }
+            pocetak.push_back(static_cast<uint32_t>(tacke.size()));
+        }
+
+        std::vector<double> objekti, paketJednaNit, paketNiti;
+        std::vector<uint32_t> omotaci, pocetakOmotaca;
+        for (int r = -p.merenje.zagrevanja; r < p.merenje.ponavljanja; r++) {
+            const auto t0 = std::chrono::steady_clock::now();
+            for (const auto &skup : skupovi) {
+                KonveksniOmotac omotac(skup, poObjektu);
+                omotac.pokreniAlgoritam();
+            }
+            const auto t1 = std::chrono::steady_clock::now();
+            geometrija::paketniOmotaci<Koordinata>(tacke, pocetak, omotaci, pocetakOmotaca, 1);
+            const auto t2 = std::chrono::steady_clock::now();
+            geometrija::paketniOmotaci<Koordinata>(tacke, pocetak, omotaci, pocetakOmotaca, niti);
+            const auto t3 = std::chrono::steady_clock::now();
+
+            if (r >= 0) {
+                objekti.push_back(std::chrono::duration<double>(t1 - t0).count());
+                paketJednaNit.push_back(std::chrono::duration<double>(t2 - t1).count());
+                paketNiti.push_back(std::chrono::duration<double>(t3 - t2).count());
+            }
+        }
+
+        const auto so = merenje::izracunajStatistiku(objekti);
+        const auto s1 = merenje::izracunajStatistiku(paketJednaNit);
+        const auto sn = merenje::izracunajStatistiku(paketNiti);
+        const auto varijanta = "paket_niti_" + std::to_string(niti);
+        rezultati.push_back(napraviRezultat(p, "objekti", n, seme, so));
+        rezultati.push_back(napraviRezultat(p, "paket_niti_1", n, seme, s1));
+        if (niti > 1)
+            rezultati.push_back(napraviRezultat(p, varijanta.c_str(), n, seme, sn));
+        for (auto it = rezultati.end() - (niti > 1 ? 3 : 2); it != rezultati.end(); ++it)
+            it->oblast = STRANICA_PAKETA;
+        std::cout << n << '\t' << seme << '\t' << m << '\t' << niti << '\t' << so.medijana
+                  << '\t' << s1.medijana << '\t' << sn.medijana
+                  << '\t' << (s1.medijana > 0 ? so.medijana / s1.medijana : 0)
+                  << '\t' << (sn.medijana > 0 ? s1.medijana / sn.medijana : 0) << std::endl;
+    }
+    return rezultati;
+}
+
+/* Omotac binarne datoteke (--datoteka); po potrebi se datoteka prvo pravi */
+int obradiDatoteku(const Parametri &p)
+{
+    using Koordinata = KOORDINATA_OMOTACA;
+
+    if (p.generisi > 0) {
+        /* Tacke se generisu i upisuju deo po deo, pa ni ovde memorija ne raste sa N */
+        GeneratorUlaza generator(p.seme, p.merenje.raspodela);
+        geometrija::Tacke2D<Koordinata> deo;
+        for (long long od = 0; od < p.generisi; od += static_cast<long long>(p.tacakaPoDelu)) {
+            const auto m = static_cast<int>(std::min<long long>(static_cast<long long>(p.tacakaPoDelu),
+                                                                p.generisi - od));
+            deo.clear();
+            for (const auto &t : generator.tacke2D(m, 0, 1 << 30, 0, 1 << 30, true))
+                deo.push_back(static_cast<Koordinata>(t.x), static_cast<Koordinata>(t.y));
+            if (!geometrija::upisiTacke<Koordinata>(p.datoteka, deo, od > 0)) {
+                std::cerr << "Datoteka " << p.datoteka << " ne moze da se upise" << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    std::cout << "# datoteka=" << p.datoteka << " deo=" << p.tacakaPoDelu
+              << " strategija=" << geometrija::imeStrategije(p.merenje.omotac.strategija)
+              << " odbacivanje=" << p.merenje.omotac.odbacivanjeUnutrasnjih
+              << " revizija=" << merenje::revizijaKoda() << std::endl;
+
+    geometrija::Tacke2D<Koordinata> temena;
+    if (p.merenje.pratiAlokacije)
+        PracenjeAlokacija::pokreni();
+    const auto pocetak = std::chrono::steady_clock::now();
+    const bool uspeh = geometrija::omotacDatoteke<Koordinata>(p.datoteka, temena, p.merenje.omotac,
+                                                              p.tacakaPoDelu);
+    const auto kraj = std::chrono::steady_clock::now();
+    const auto alokacije = p.merenje.pratiAlokacije ? PracenjeAlokacija::zaustavi()
+                                                    : PracenjeAlokacija::Vrednosti();
+    if (!uspeh) {
+        std::cerr << "Datoteka " << p.datoteka << " ne moze da se procita kao binarna datoteka tacaka"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "# vreme\ttemena" << std::endl
+              << std::chrono::duration<double>(kraj - pocetak).count() << '\t'
+              << (temena.empty() ? 0 : temena.size() - 1) << std::endl;
+    if (alokacije.dostupno)
+        std::cout << "# " << alokacije.opis(0) << std::endl;
+    return EXIT_SUCCESS;
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+    Parametri p;
+    TipAlgoritma tip;
+    if (!procitajParametre(argc, argv, p) || (p.datoteka.empty() && !nadjiAlgoritam(p.algoritam, tip))) {
+        ispisiUpotrebu(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+#ifdef __linux__
+    if (p.jezgro >= 0) {
+        cpu_set_t jezgra;
+        CPU_ZERO(&jezgra);
+        CPU_SET(p.jezgro, &jezgra);
+        if (sched_setaffinity(0, sizeof(jezgra), &jezgra) != 0)
+            std::cerr << "Upozorenje: vezivanje za jezgro " << p.jezgro << " nije uspelo" << std::endl;
+    }
+#endif
+
+    if (!p.datoteka.empty())
+        return obradiDatoteku(p);
+
+    /* Osnova se ucitava pre merenja, da greska u imenu ne bi potrosila celo merenje */
+    std::vector<merenje::RezultatMerenja> osnova;
+    if (!p.osnova.empty() && !merenje::ucitajCsv(p.osnova, osnova)) {
+        std::cerr << "Osnova " << p.osnova << " ne moze da se ucita" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (!HardverskiBrojaci().dostupni())
+        std::cout << "# hardverski brojaci nedostupni (perf_event_paranoid?), meri se samo vreme\n";
+
+    /* Seme ulaza velicine n je kolona "seme"; ponavljanje r koristi seme + r.
+     * Isti --seme i --raspodela ponavljaju bilo koju velicinu i zasebno. */
+    std::cout << "# algoritam=" << p.algoritam << " seme=" << p.seme
+              << " raspodela=" << imeRaspodele(p.merenje.raspodela)
+              << " zagrevanja=" << p.merenje.zagrevanja
+              << " ponavljanja=" << p.merenje.ponavljanja
+              << " budzet=" << p.merenje.budzet
+              << " odbacivanje=" << p.merenje.omotac.odbacivanjeUnutrasnjih
+              << " niti=" << p.merenje.omotac.brojNiti
+              << " simd=" << geometrija::skupInstrukcija()
+              << " revizija=" << merenje::revizijaKoda() << std::endl;
+
+    const auto rezultati = p.tacakaPoSkupu > 0 ? meriPaket(p)
+                           : p.ubrzanje      ? meriUbrzanje(p, tip)
+                                             : meriVelicine(p, tip);
+
+    if (!p.json.empty() && !merenje::sacuvajJson(rezultati, p.json))
+        std::cerr << "Upozorenje: " << p.json << " ne moze da se upise" << std::endl;
+    if (!p.csv.empty() && !merenje::sacuvajCsv(rezultati, p.csv))
+        std::cerr << "Upozorenje: " << p.csv << " ne moze da se upise" << std::endl;
+
+    if (!p.osnova.empty()) {
+        const auto regresije = merenje::uporedi(osnova, rezultati, p.prag);
+        std::cout << "# poredjenje sa " << p.osnova << " (prag " << p.prag * 100 << "%): "
+                  << regresije.size() << " sporijih velicina" << std::endl;
+        for (const auto &r : regresije)
+            std::cout << "#   " << merenje::opisRegresije(r) << std::endl;
+        if (!regresije.empty())
+            return KOD_REGRESIJE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,79 @@
+#ifndef GA_CORE_BAZEN_H
+#define GA_CORE_BAZEN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace geometrija {
+
+///
+/// \brief The Bazen class
+/// Objekti tipa T jedne strukture (npr. omotaca) u blokovima fiksne velicine,
+/// umesto zasebnog new za svaki. Objekat dobija indeks svog mesta, a adresa i
+/// indeks su stabilni dok se ne oslobodi; oslobodjena mesta se ponovo koriste
+/// (lista slobodnih). Ceo bazen se oslobadja odjednom, blok po blok, bez
+/// destruktora pojedinacnih objekata, pa T mora da ima trivijalan destruktor.
+///
+template <typename T, size_t VELICINA_BLOKA = 1024>
+class Bazen
+{
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "objekti u bazenu se ne unistavaju pojedinacno");
+
+public:
+    Bazen() = default;
+    Bazen(const Bazen &) = delete;
+    Bazen& operator=(const Bazen &) = delete;
+
+    /* Novi objekat T(indeks, argumenti...), na oslobodjenom mestu ako ga ima */
+    template <typename... A>
+    T *napravi(A&&... argumenti)
+    {
+        uint32_t indeks;
+        if (!_slobodna.empty()) {
+            indeks = _slobodna.back();
+            _slobodna.pop_back();
+        } else {
+            indeks = _brojMesta++;
+            if (indeks % VELICINA_BLOKA == 0)
+                _blokovi.emplace_back(new Mesto[VELICINA_BLOKA]);
+        }
+        return new (&mesto(indeks)) T(indeks, std::forward<A>(argumenti)...);
+    }
+
+    /* Mesto objekta se vraca u bazen; objekat ostaje citljiv do sledeceg napravi */
+    void oslobodi(const T *objekat) { _slobodna.push_back(objekat->indeks()); }
+
+    /* Objekat na mestu indeks; mesto mora biti zauzeto */
+    T *operator[](uint32_t indeks) { return reinterpret_cast<T *>(&mesto(indeks)); }
+    const T *operator[](uint32_t indeks) const { return reinterpret_cast<const T *>(&mesto(indeks)); }
+
+    /* Broj mesta ikada zauzetih, ukljucujuci oslobodjena; indeksi su manji od njega */
+    size_t brojMesta() const { return _brojMesta; }
+
+    void clear()
+    {
+        _blokovi.clear();
+        _slobodna.clear();
+        _brojMesta = 0;
+    }
+
+private:
+    using Mesto = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    Mesto &mesto(uint32_t indeks) { return _blokovi[indeks / VELICINA_BLOKA][indeks % VELICINA_BLOKA]; }
+    const Mesto &mesto(uint32_t indeks) const { return _blokovi[indeks / VELICINA_BLOKA][indeks % VELICINA_BLOKA]; }
+
+    std::vector<std::unique_ptr<Mesto[]>> _blokovi;
+    std::vector<uint32_t> _slobodna;
+    uint32_t _brojMesta = 0;
+};
+
+}
+
+#endif // GA_CORE_BAZEN_H
@@ -0,0 +1,260 @@
+#include "dinamickiomotac2d.h"
+#include "predikati.h"
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
+namespace {
+
+/* Povrsina trougla u smeru lanca: za gornji lanac (smer 1) je negativna kada
+ * c skrece udesno od ab, kao kod Gremovog algoritma; za donji je obrnuto */
+template <typename T>
+inline geometrija::Siroki<T> povrsinaUSmeru(int smer, T ax, T ay, T bx, T by, T cx, T cy)
+{
+    const auto P = geometrija::povrsinaTrougla<T>(ax, ay, bx, by, cx, cy);
+    return smer > 0 ? P : -P;
+}
+
+/* Da li je y na istom x dalje u smeru lanca (iznad gornjeg, ispod donjeg) */
+template <typename T>
+inline bool dalje(int smer, T y, T drugo)
+{
+    return smer > 0 ? y > drugo : y < drugo;
+}
+
+}
+
+template <typename T>
+bool geometrija::DinamickiOmotac<T>::dodajULanac(Lanac &lanac, int smer, T x, T y, uint32_t indeks)
+{
+    auto it = lanac.lower_bound(x);
+    if (it != lanac.end() && it->first == x) {
+        /* Na istom x lanac cuva samo krajnju tacku */
+        if (!dalje(smer, y, it->second.y))
+            return false;
+        it->second = {y, indeks};
+    } else {
+        /* Tacka izmedju dva temena mora biti izvan duzi koja ih spaja */
+        if (it != lanac.end() && it != lanac.begin()) {
+            const auto pret = std::prev(it);
+            if (povrsinaUSmeru<T>(smer, pret->first, pret->second.y, it->first, it->second.y, x, y) <= 0)
+                return false;
+        }
+        it = lanac.emplace_hint(it, x, Teme{y, indeks});
+    }
+
+    /* Temena koja vise ne prave skretanje udesno (u smeru lanca) se izbacuju
+     * sa obe strane nove tacke; svako teme se izbacuje najvise jednom */
+    for (auto sledece = std::next(it); sledece != lanac.end(); ) {
+        const auto iza = std::next(sledece);
+        if (iza == lanac.end() ||
+            povrsinaUSmeru<T>(smer, x, y, sledece->first, sledece->second.y, iza->first, iza->second.y) < 0)
+            break;
+        sledece = lanac.erase(sledece);
+    }
+    while (it != lanac.begin()) {
+        const auto pret = std::prev(it);
+        if (pret == lanac.begin())
+            break;
+        const auto ispred = std::prev(pret);
+        if (povrsinaUSmeru<T>(smer, ispred->first, ispred->second.y, pret->first, pret->second.y, x, y) < 0)
+            break;
+        lanac.erase(pret);
+    }
+    return true;
+}
+
+template <typename T>
+bool geometrija::DinamickiOmotac<T>::unutarLanca(const Lanac &lanac, int smer, T x, T y)
+{
+    const auto it = lanac.lower_bound(x);
+    if (it == lanac.end())
+        return false;
+    if (it->first == x)
+        return !dalje(smer, y, it->second.y);
+    if (it == lanac.begin())
+        return false;
+
+    const auto pret = std::prev(it);
+    return povrsinaUSmeru<T>(smer, pret->first, pret->second.y, it->first, it->second.y, x, y) <= 0;
+}
+
+template <typename T>
+void geometrija::DinamickiOmotac<T>::izgradiLanac(Lanac &lanac, int smer, const std::vector<T> &x,
+                                                  const std::vector<T> &y,
+                                                  const std::vector<uint32_t> &indeksi,
+                                                  const std::vector<uint32_t> &redosled)
+{
+    /* Monotoni lanac nad leksikografski sortiranim tackama; od tacaka sa istim
+     * x ostaje krajnja, a od jednakih prva (sortiranje je stabilno) */
+    std::vector<uint32_t> stek;
+    for (auto k : redosled) {
+        if (!stek.empty() && x[stek.back()] == x[k]) {
+            if (!dalje(smer, y[k], y[stek.back()]))
+                continue;
+            stek.pop_back();
+        }
+        while (stek.size() >= 2) {
+            const auto a = stek[stek.size() - 2], b = stek.back();
+            if (povrsinaUSmeru<T>(smer, x[a], y[a], x[b], y[b], x[k], y[k]) < 0)
+                break;
+            stek.pop_back();
+        }
+        stek.push_back(k);
+    }
+
+    lanac.clear();
+    for (auto k : stek)
+        lanac.emplace_hint(lanac.end(), x[k], Teme{y[k], indeksi[k]});
+}
+
+template <typename T>
+bool geometrija::DinamickiOmotac<T>::dodaj(T x, T y, uint32_t indeks)
+{
+    /* Bitovni ili, jer tacka mora u oba lanca */
+    return dodajULanac(_gornji, 1, x, y, indeks) | dodajULanac(_donji, -1, x, y, indeks);
+}
+
+template <typename T>
+void geometrija::DinamickiOmotac<T>::dodaj(PogledTacaka2D<T> tacke, uint32_t prviIndeks)
+{
+    const auto n = tacke.size();
+    if (n < brojTemena()) {
+        for (size_t i = 0; i < n; i++)
+            dodaj(tacke.x[i], tacke.y[i], prviIndeks + static_cast<uint32_t>(i));
+        return;
+    }
+
+    /* Temena pre paketa, da bi od jednakih tacaka ostala ranija */
+    std::vector<T> x, y;
+    std::vector<uint32_t> indeksi;
+    const auto m = brojTemena() + n;
+    x.reserve(m);
+    y.reserve(m);
+    indeksi.reserve(m);
+    obidji([&](T tx, T ty, uint32_t indeks) {
+        x.push_back(tx);
+        y.push_back(ty);
+        indeksi.push_back(indeks);
+    });
+    for (size_t i = 0; i < n; i++) {
+        x.push_back(tacke.x[i]);
+        y.push_back(tacke.y[i]);
+        indeksi.push_back(prviIndeks + static_cast<uint32_t>(i));
+    }
+
+    std::vector<uint32_t> redosled(x.size());
+    std::iota(redosled.begin(), redosled.end(), 0);
+    std::stable_sort(redosled.begin(), redosled.end(), [&](uint32_t a, uint32_t b) {
+        return x[a] < x[b] || (x[a] == x[b] && y[a] < y[b]);
+    });
+
+    izgradiLanac(_gornji, 1, x, y, indeksi, redosled);
+    izgradiLanac(_donji, -1, x, y, indeksi, redosled);
+}
+
+template <typename T>
+bool geometrija::DinamickiOmotac<T>::sadrzi(T x, T y) const
+{
+    return unutarLanca(_gornji, 1, x, y) && unutarLanca(_donji, -1, x, y);
+}
+
+template <typename T>
+template <typename F>
+void geometrija::DinamickiOmotac<T>::obidji(F f) const
+{
+    if (_donji.empty())
+        return;
+
+    /* Donji lanac zdesna nalevo, pa gornji sleva nadesno; oba lanca imaju iste
+     * krajnje x koordinate, pa se krajnja temena gornjeg preskacu ako se
+     * poklapaju sa temenima donjeg */
+    for (auto it = _donji.rbegin(); it != _donji.rend(); ++it)
+        f(it->first, it->second.y, it->second.indeks);
+
+    auto od = _gornji.begin();
+    auto kraj = _gornji.end();
+    if (od->second.y == _donji.begin()->second.y)
+        ++od;
+    if (_gornji.size() > 1 && std::prev(kraj)->second.y == _donji.rbegin()->second.y)
+        --kraj;
+    for (; od != kraj; ++od)
+        f(od->first, od->second.y, od->second.indeks);
+}
+
+template <typename T>
+void geometrija::DinamickiOmotac<T>::omotac(std::vector<uint32_t> &indeksi) const
+{
+    indeksi.clear();
+    if (empty())
+        return;
+
+    indeksi.reserve(brojTemena() + 1);
+    obidji([&](T, T, uint32_t indeks) { indeksi.push_back(indeks); });
+    indeksi.push_back(indeksi.front());
+}
+
+template <typename T>
+void geometrija::DinamickiOmotac<T>::temena(Tacke2D<T> &temena) const
+{
+    temena.clear();
+    if (empty())
+        return;
+
+    temena.reserve(brojTemena() + 1);
+    obidji([&](T x, T y, uint32_t) { temena.push_back(x, y); });
+    temena.push_back(temena.x.front(), temena.y.front());
+}
+
+template <typename T>
+size_t geometrija::DinamickiOmotac<T>::brojTemena() const
+{
+    if (empty())
+        return 0;
+
+    size_t h = _gornji.size() + _donji.size();
+    h -= _gornji.begin()->second.y == _donji.begin()->second.y;
+    h -= _gornji.size() > 1 && _gornji.rbegin()->second.y == _donji.rbegin()->second.y;
+    return h;
+}
+
+template <typename T>
+void geometrija::DinamickiOmotac<T>::clear()
+{
+    _gornji.clear();
+    _donji.clear();
+}
+
+template <typename T>
+bool geometrija::dinamickiOmotac(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+                                 Posmatrac *posmatrac)
+{
+    omotac.clear();
+    const auto n = tacke.size();
+
+    /* Izdvajanje posle svake promene je O(h), pa se radi samo za crtanje */
+    const bool crta = posmatrac && posmatrac->crta();
+
+    Posmatrac_faza(posmatrac, "umetanje")
+    DinamickiOmotac<T> dinamicki;
+    for (uint32_t i = 0; i < n; i++) {
+        if (dinamicki.dodaj(tacke.x[i], tacke.y[i], i) && crta)
+            dinamicki.omotac(omotac);
+        Posmatrac_korak(posmatrac)
+    }
+
+    Posmatrac_faza(posmatrac, "izdvajanje")
+    dinamicki.omotac(omotac);
+    Posmatrac_korak(posmatrac)
+    return true;
+}
+
+template class geometrija::DinamickiOmotac<int32_t>;
+template bool geometrija::dinamickiOmotac<int32_t>(PogledTacaka2D<int32_t>, std::vector<uint32_t> &,
+                                                   Posmatrac *);
+#ifdef __SIZEOF_INT128__
+template class geometrija::DinamickiOmotac<int64_t>;
+template bool geometrija::dinamickiOmotac<int64_t>(PogledTacaka2D<int64_t>, std::vector<uint32_t> &,
+                                                   Posmatrac *);
+#endif
@@ -0,0 +1,87 @@
+#ifndef GA_CORE_DINAMICKIOMOTAC2D_H
+#define GA_CORE_DINAMICKIOMOTAC2D_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "posmatrac.h"
+#include "tacke.h"
+
+namespace geometrija {
+
+///
+/// \brief The DinamickiOmotac class
+/// Konveksni omotac tacaka koje stizu jedna po jedna, bez ponovnog racunanja
+/// celog omotaca: gornji i donji lanac se cuvaju u balansiranim stablima
+/// (std::map po x koordinati), pa umetanje i upit kostaju O(log n) (umetanje
+/// amortizovano, jer se svako teme izbacuje najvise jednom), a izdvajanje
+/// omotaca O(h). Cuvaju se samo temena; tacke unutar omotaca se odmah odbacuju.
+/// Tacka se pamti po indeksu koji zada pozivalac; od jednakih tacaka ostaje prva.
+///
+template <typename T>
+class DinamickiOmotac
+{
+public:
+    /* Dodaje tacku; true ako je postala teme omotaca (omotac se promenio) */
+    bool dodaj(T x, T y, uint32_t indeks);
+
+    ///
+    /// \brief dodaj - paket tacaka sa indeksima prviIndeks, prviIndeks + 1, ...
+    ///     Paket veci od tekuceg omotaca se ne umece tacku po tacku, vec se omotac
+    ///     gradi iznova od temena i paketa (sortiranje, pa monotoni lanac).
+    ///
+    void dodaj(PogledTacaka2D<T> tacke, uint32_t prviIndeks = 0);
+
+    /* Da li je tacka unutar omotaca ili na njegovoj granici, O(log h) */
+    bool sadrzi(T x, T y) const;
+
+    ///
+    /// \brief omotac - indeksi temena u O(h), u obliku kao kod gremovOmotac: od
+    ///     tacke sa najvecom x koordinatom (najmanjom y medju njima), u smeru
+    ///     kazaljke na satu, sa prvim temenom ponovljenim na kraju
+    ///
+    void omotac(std::vector<uint32_t> &indeksi) const;
+
+    /* Koordinate temena, istim redom kao omotac() */
+    void temena(Tacke2D<T> &temena) const;
+
+    size_t brojTemena() const;
+    bool empty() const { return _gornji.empty(); }
+    void clear();
+
+private:
+    struct Teme {
+        T y;
+        uint32_t indeks;
+    };
+
+    /* Temena lanca po x; gornji lanac ima smer 1, donji -1 */
+    using Lanac = std::map<T, Teme>;
+
+    static bool dodajULanac(Lanac &lanac, int smer, T x, T y, uint32_t indeks);
+    static bool unutarLanca(const Lanac &lanac, int smer, T x, T y);
+    static void izgradiLanac(Lanac &lanac, int smer, const std::vector<T> &x,
+                             const std::vector<T> &y, const std::vector<uint32_t> &indeksi,
+                             const std::vector<uint32_t> &redosled);
+
+    template <typename F>
+    void obidji(F f) const;
+
+    Lanac _gornji, _donji;
+};
+
+///
+/// \brief dinamickiOmotac - omotac umetanjem tacaka jedne po jedne u
+///     DinamickiOmotac, O(n log n). Posle umetanja koje promeni omotac, a samo
+///     ako posmatrac crta, omotac se izdvaja da bi se nacrtao. Izlaz je isti
+///     kao kod gremovOmotac.
+///
+template <typename T>
+bool dinamickiOmotac(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+                     Posmatrac *posmatrac = nullptr);
+
+}
+
+#endif // GA_CORE_DINAMICKIOMOTAC2D_H
@@ -0,0 +1,25 @@
+# Geometrijsko jezgro bez Qt-a: predikati i algoritmi nad nizovima koordinata.
+# Ukljucuje ga algoritmi.pri; za upotrebu van GUI-ja postoji i ga_core.pro
+# (staticka biblioteka). Zaglavlja se ukljucuju kao "ga_core/...".
+INCLUDEPATH += $$PWD/..
+
+SOURCES += \
+    $$PWD/dinamickiomotac2d.cpp \
+    $$PWD/konveksniomotac2d.cpp \
+    $$PWD/konveksniomotac3d.cpp \
+    $$PWD/paketnipredikati.cpp \
+    $$PWD/predikati.cpp \
+    $$PWD/presekduzi.cpp \
+    $$PWD/spoljniomotac2d.cpp
+
+HEADERS += \
+    $$PWD/bazen.h \
+    $$PWD/dinamickiomotac2d.h \
+    $$PWD/konveksniomotac2d.h \
+    $$PWD/konveksniomotac3d.h \
+    $$PWD/paketnipredikati.h \
+    $$PWD/posmatrac.h \
+    $$PWD/predikati.h \
+    $$PWD/presekduzi.h \
+    $$PWD/spoljniomotac2d.h \
+    $$PWD/tacke.h
@@ -0,0 +1,9 @@
+# Staticka biblioteka ga_core, bez zavisnosti od Qt-a, za upotrebu u
+# programima koji ne linkuju QtGui.
+TEMPLATE = lib
+CONFIG += staticlib c++14 thread
+CONFIG -= qt
+
+TARGET = ga_core
+
+include(ga_core.pri)
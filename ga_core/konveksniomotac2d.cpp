@@ -0,0 +1,941 @@
+#include "konveksniomotac2d.h"
+#include "dinamickiomotac2d.h"
+#include "predikati.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+
+namespace {
+
+const char *const imenaStrategija[] = {
+    "grem",
+    "monotoni_lanac",
+    "cen",
+    "paralelni",
+    "dinamicki",
+    "quickhull",
+};
+
+/* Manji ulazi se sortiraju poredjenjem; radix sortiranje se isplati tek
+ * kada n nadmasi broj prolaza kroz tablice brojaca */
+const size_t MIN_RADIX = 256;
+
+/* Koordinata kao neoznacen kljuc istog redosleda (obrnut bit znaka) */
+template <typename T>
+struct Kljuc {
+    using U = typename std::make_unsigned<T>::type;
+    U k;
+    uint32_t i;
+};
+
+template <typename T>
+inline typename Kljuc<T>::U neoznacen(T v)
+{
+    using U = typename Kljuc<T>::U;
+    return static_cast<U>(v) ^ (U(1) << (8*sizeof(U) - 1));
+}
+
+/* Stabilno LSD radix sortiranje po bajtovima kljuca. Brojaci svih bajtova se
+ * skupljaju u jednom prolazu, a bajt u kome se svi kljucevi slazu (npr. visi
+ * bajtovi malih koordinata) se preskace. */
+template <typename T>
+void radixSortiraj(std::vector<Kljuc<T>> &a, std::vector<Kljuc<T>> &pom)
+{
+    const size_t n = a.size();
+    size_t brojevi[sizeof(T)][256] = {};
+    for (const auto &e : a)
+        for (unsigned b = 0; b < sizeof(T); b++)
+            brojevi[b][(e.k >> 8*b) & 0xFF]++;
+
+    for (unsigned b = 0; b < sizeof(T); b++) {
+        if (brojevi[b][(a[0].k >> 8*b) & 0xFF] == n)
+            continue;
+
+        size_t pozicija = 0;
+        for (auto &broj : brojevi[b]) {
+            const auto m = broj;
+            broj = pozicija;
+            pozicija += m;
+        }
+        for (const auto &e : a)
+            pom[brojevi[b][(e.k >> 8*b) & 0xFF]++] = e;
+        a.swap(pom);
+    }
+}
+
+/* Indeksi tacaka u leksikografskom redosledu (x, pa y); a i pom su radni
+ * nizovi radix sortiranja, koje pozivalac moze da cuva izmedju poziva */
+template <typename T>
+void leksikografskiRedosled(const T *x, const T *y, size_t n, std::vector<uint32_t> &redosled,
+                            std::vector<Kljuc<T>> &a, std::vector<Kljuc<T>> &pom)
+{
+    redosled.resize(n);
+    if (n < MIN_RADIX) {
+        std::iota(redosled.begin(), redosled.end(), 0);
+        std::sort(redosled.begin(), redosled.end(), [&](uint32_t lhs, uint32_t rhs) {
+            return x[lhs] < x[rhs] || (x[lhs] == x[rhs] && y[lhs] < y[rhs]);
+        });
+        return;
+    }
+
+    /* Prvo po sporednom kljucu (y), pa stabilno po glavnom (x) */
+    a.resize(n);
+    pom.resize(n);
+    for (uint32_t i = 0; i < n; i++)
+        a[i] = {neoznacen(y[i]), i};
+    radixSortiraj(a, pom);
+
+    for (auto &e : a)
+        e.k = neoznacen(x[e.i]);
+    radixSortiraj(a, pom);
+
+    for (size_t i = 0; i < n; i++)
+        redosled[i] = a[i].i;
+}
+
+template <typename T>
+void leksikografskiRedosled(const T *x, const T *y, size_t n, std::vector<uint32_t> &redosled)
+{
+    std::vector<Kljuc<T>> a, pom;
+    leksikografskiRedosled(x, y, n, redosled, a, pom);
+}
+
+/* Omotac (sa ponovljenim prvim temenom) se pomera tako da pocne od iste
+ * tacke kao kod Gremovog algoritma (najveci x, pa najmanji y) */
+template <typename T>
+void pocniOdNajvece(const T *x, const T *y, std::vector<uint32_t> &omotac)
+{
+    size_t max = 0;
+    for (size_t i = 1; i + 1 < omotac.size(); i++) {
+        const auto a = omotac[i], b = omotac[max];
+        if (x[a] > x[b] || (x[a] == x[b] && y[a] < y[b]))
+            max = i;
+    }
+    std::rotate(omotac.begin(), omotac.begin() + max, omotac.end() - 1);
+    omotac.back() = omotac.front();
+}
+
+/* Najmanja grupa Cenovog algoritma; manje grupe bi bile skuplje od ustede */
+const unsigned CEN_POCETNI_STEPEN = 2;
+
+/* Da li je b bolje sledece teme omotaca posle p od a: omotac se obilazi kao
+ * kod Gremovog algoritma, pa je bolja tacka levo od pa, a od kolinearnih dalja.
+ * Tacka jednaka p nikad nije bolja. */
+template <typename T>
+inline bool bolja(const T *x, const T *y, uint32_t p, uint32_t a, uint32_t b)
+{
+    if (x[b] == x[p] && y[b] == y[p])
+        return false;
+    if (x[a] == x[p] && y[a] == y[p])
+        return true;
+
+    const auto P = geometrija::povrsinaTrougla<T>(x[p], y[p], x[a], y[a], x[b], y[b]);
+    return P > 0 || (P == 0 && geometrija::distanceKvadrat<T>(x[p], y[p], x[b], y[b])
+                               > geometrija::distanceKvadrat<T>(x[p], y[p], x[a], y[a]));
+}
+
+/* Najbolje teme konveksnog mnogougla h (k temena, bez ponovljenog prvog) kao
+ * sledece posle temena p ukupnog omotaca. Posmatrano iz p, temena se po
+ * redosledu "bolja" ciklicno prvo penju do najboljeg pa spustaju, pa se
+ * najbolje nalazi binarnom pretragom u O(log k). */
+template <typename T>
+uint32_t tangenta(const T *x, const T *y, uint32_t p, const uint32_t *h, size_t k)
+{
+    const auto bolje = [&](size_t i, size_t j) {
+        return bolja(x, y, p, h[i % k], h[j % k]);
+    };
+
+    /* Najbolje teme je uvek u [lo, hi] (hi = k je opet teme 0) */
+    size_t lo = 0, hi = k;
+    while (hi - lo > 1) {
+        const size_t s = (lo + hi) / 2;
+        const bool loRaste = bolje(lo, lo + 1);
+        const bool sRaste = bolje(s, s + 1);
+        const bool sBolje = bolje(lo, s);
+        if (loRaste ? (sRaste && sBolje) : (sRaste || !sBolje))
+            lo = s;
+        else
+            hi = s;
+    }
+    size_t t = bolje(lo, hi) ? hi % k : lo;
+
+    /* Ponovljena temena (ili p na mnogouglu) kvare strogu unimodalnost;
+     * tada se najbolje dostize i lokalnim pomeranjem */
+    while (bolje(t, t + 1))
+        t = (t + 1) % k;
+    while (bolje(t, t + k - 1))
+        t = (t + k - 1) % k;
+    return h[t];
+}
+
+
+/* Najmanje tacaka po niti paralelnog omotaca; za manje ulaze pokretanje
+ * niti kosta vise od ustede */
+const size_t MIN_TACAKA_PO_NITI = 1 << 15;
+
+/* Velicina uzorka po pojasu, iz koga se biraju granice pojaseva */
+const size_t UZORAK_PO_POJASU = 64;
+
+/* f(0), ..., f(k - 1), svaki u svojoj niti; f(0) radi nit pozivaoca */
+template <typename F>
+void uNitima(unsigned k, const F &f)
+{
+    std::vector<std::thread> niti;
+    niti.reserve(k - 1);
+    for (unsigned i = 1; i < k; i++)
+        niti.emplace_back(f, i);
+    f(0);
+    for (auto &nit : niti)
+        nit.join();
+}
+
+/* Gornji i donji lanac omotaca, oba sleva nadesno */
+struct Lanci {
+    std::vector<uint32_t> gornji, donji;
+};
+
+/* Lanci tacaka u leksikografskom redosledu; gornji zadrzava skretanja
+ * udesno, a donji ulevo */
+template <typename T>
+void napraviLance(const T *x, const T *y, const std::vector<uint32_t> &redosled, Lanci &lanci)
+{
+    const auto dodaj = [&](std::vector<uint32_t> &lanac, uint32_t k, bool gornji) {
+        while (lanac.size() >= 2) {
+            const auto m = lanac.size();
+            const auto P = geometrija::povrsinaTrougla<T>(x[lanac[m-2]], y[lanac[m-2]],
+                                                          x[lanac[m-1]], y[lanac[m-1]], x[k], y[k]);
+            if (gornji ? P < 0 : P > 0)
+                break;
+            lanac.pop_back();
+        }
+        lanac.push_back(k);
+    };
+
+    lanci.gornji.clear();
+    lanci.donji.clear();
+    for (auto k : redosled) {
+        dodaj(lanci.gornji, k, true);
+        dodaj(lanci.donji, k, false);
+    }
+}
+
+/* Spajanje lanca levog omotaca sa lancem desnog, kada su omotaci razdvojeni
+ * po x: kraj levog lanca se pomera ulevo, a pocetak desnog udesno, dok god
+ * sledece teme nije strogo sa unutrasnje strane prave kroz tekuce krajeve.
+ * Ta prava je tada zajednicka tangenta (most) i lanci se spajaju preko nje. */
+template <typename T>
+void spojiLance(const T *x, const T *y, std::vector<uint32_t> &levi,
+                const std::vector<uint32_t> &desni, bool gornji)
+{
+    size_t i = levi.size() - 1, j = 0;
+    const auto spolja = [&](uint32_t c) {
+        const auto P = geometrija::povrsinaTrougla<T>(x[levi[i]], y[levi[i]],
+                                                      x[desni[j]], y[desni[j]], x[c], y[c]);
+        return gornji ? P >= 0 : P <= 0;
+    };
+
+    for (bool pomereno = true; pomereno; ) {
+        pomereno = false;
+        while (i > 0 && spolja(levi[i-1])) {
+            i--;
+            pomereno = true;
+        }
+        while (j + 1 < desni.size() && spolja(desni[j+1])) {
+            j++;
+            pomereno = true;
+        }
+    }
+
+    levi.resize(i + 1);
+    levi.insert(levi.end(), desni.begin() + j, desni.end());
+}
+
+/* Gornji lanac sleva nadesno, pa donji zdesna nalevo, kao kod monotonog lanca */
+template <typename T>
+void omotacIzLanaca(const T *x, const T *y, const Lanci &lanci, std::vector<uint32_t> &omotac)
+{
+    omotac = lanci.gornji;
+    for (size_t i = lanci.donji.size() - 1; i-- > 0; )
+        omotac.push_back(lanci.donji[i]);
+    if (omotac.size() == 1)
+        omotac.push_back(omotac.front());
+    pocniOdNajvece(x, y, omotac);
+}
+
+/* Skupovi koje nit paketnih omotaca uzima odjednom */
+const size_t BLOK_SKUPOVA = 64;
+
+/* Radni nizovi jedne niti paketnih omotaca; cuvaju se izmedju skupova, pa
+ * omotac skupa ne alocira cim nizovi narastu do najveceg skupa */
+template <typename T>
+struct RadniNizovi {
+    std::vector<uint32_t> redosled;
+    std::vector<Kljuc<T>> kljucevi, pom;
+    Lanci lanci;
+    std::vector<uint32_t> omotac;
+};
+
+/* Omotac jednog skupa monotonim lancem, u r.omotac */
+template <typename T>
+void omotacSkupa(const T *x, const T *y, size_t n, RadniNizovi<T> &r)
+{
+    r.omotac.clear();
+    if (n == 0)
+        return;
+    leksikografskiRedosled(x, y, n, r.redosled, r.kljucevi, r.pom);
+    napraviLance(x, y, r.redosled, r.lanci);
+    omotacIzLanaca(x, y, r.lanci, r.omotac);
+}
+
+/* Tacke Quickhull-a: koordinate i indeksi ulaza kao zasebni nizovi */
+template <typename T>
+struct NizoviTacaka {
+    std::vector<T> x, y;
+    std::vector<uint32_t> i;
+
+    explicit NizoviTacaka(size_t n)
+        : x(n), y(n), i(n)
+    {}
+};
+
+/* Pozicija najdalje tacke levo od AB, medju n tacaka koje su sve strogo levo.
+ * Prvi prolaz trazi samo najvecu povrsinu, bez grananja, pa se vektorizuje;
+ * drugi bira tacku sa tom povrsinom koja je najdalje u smeru AB, jer je ona,
+ * za razliku od ostalih na istoj pravoj paralelnoj sa AB, teme omotaca. */
+template <typename T>
+size_t najdaljaTacka(const T *x, const T *y, size_t n, T ax, T ay, T bx, T by)
+{
+    using S = geometrija::Siroki<T>;
+    const S dx = S(bx) - ax, dy = S(by) - ay;
+
+    S najveca = 0;
+    for (size_t i = 0; i < n; i++)
+        najveca = std::max(najveca, dx*(S(y[i]) - ay) - dy*(S(x[i]) - ax));
+
+    size_t c = 0;
+    S najdalje = dx*x[0] + dy*y[0];
+    bool nadjena = false;
+    for (size_t i = 0; i < n; i++) {
+        const S smer = dx*x[i] + dy*y[i];
+        const bool bolja = dx*(S(y[i]) - ay) - dy*(S(x[i]) - ax) == najveca && (!nadjena || smer > najdalje);
+        c = bolja ? i : c;
+        najdalje = bolja ? smer : najdalje;
+        nadjena = nadjena || bolja;
+    }
+    return c;
+}
+
+/* Tacke levo od prve prave (p1 -> q1) se upisuju od pocetka odredista, a levo
+ * od druge (p2 -> q2) od kraja; ostale se odbacuju. Upis je bez grananja:
+ * tacka se upisuje na oba slobodna mesta, a pomera se samo granica strane
+ * kojoj pripada. Vraca broj tacaka na pocetku i na kraju. */
+template <typename T>
+std::pair<size_t, size_t> podeli(const T *x, const T *y, const uint32_t *ind, size_t n,
+                                 T p1x, T p1y, T q1x, T q1y, T p2x, T p2y, T q2x, T q2y,
+                                 T *dx, T *dy, uint32_t *di)
+{
+    size_t levo = 0, desno = n;
+    for (size_t i = 0; i < n; i++) {
+        const bool prva = geometrija::povrsinaTrougla<T>(p1x, p1y, q1x, q1y, x[i], y[i]) > 0;
+        const bool druga = geometrija::povrsinaTrougla<T>(p2x, p2y, q2x, q2y, x[i], y[i]) > 0;
+        dx[levo] = x[i];
+        dy[levo] = y[i];
+        di[levo] = ind[i];
+        dx[desno - 1] = x[i];
+        dy[desno - 1] = y[i];
+        di[desno - 1] = ind[i];
+        levo += prva;
+        desno -= druga;
+    }
+    return {levo, n - desno};
+}
+
+}
+
+const char *geometrija::imeStrategije(StrategijaOmotaca strategija)
+{
+    return imenaStrategija[static_cast<int>(strategija)];
+}
+
+bool geometrija::strategijaIzImena(const std::string &ime, StrategijaOmotaca &strategija)
+{
+    for (int i = 0; i < static_cast<int>(StrategijaOmotaca::BROJ_STRATEGIJA); i++) {
+        if (ime == imenaStrategija[i]) {
+            strategija = static_cast<StrategijaOmotaca>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+bool geometrija::konveksniOmotac(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+                                 const ParametriOmotaca &parametri, Posmatrac *posmatrac)
+{
+    const auto pokreni = [&](PogledTacaka2D<T> ulaz) {
+        switch (parametri.strategija) {
+        case StrategijaOmotaca::MONOTONI_LANAC:
+            return monotoniLanac(ulaz, omotac, posmatrac);
+        case StrategijaOmotaca::CEN:
+            return cenovOmotac(ulaz, omotac, posmatrac);
+        case StrategijaOmotaca::PARALELNI:
+            return paralelniOmotac(ulaz, omotac, parametri.brojNiti, posmatrac);
+        case StrategijaOmotaca::DINAMICKI:
+            return dinamickiOmotac(ulaz, omotac, posmatrac);
+        case StrategijaOmotaca::QUICKHULL:
+            return quickhull(ulaz, omotac, posmatrac);
+        default:
+            return gremovOmotac(ulaz, omotac, posmatrac);
+        }
+    };
+
+    if (!parametri.odbacivanjeUnutrasnjih)
+        return pokreni(tacke);
+
+    Posmatrac_faza(posmatrac, "odbacivanje")
+    std::vector<uint32_t> preostale;
+    odbaciUnutrasnjeTacke(tacke, preostale);
+
+    Tacke2D<T> podskup;
+    podskup.reserve(preostale.size());
+    for (auto i : preostale)
+        podskup.push_back(tacke.x[i], tacke.y[i]);
+    Posmatrac_udeo(posmatrac, tacke.size() ? 1 - static_cast<double>(preostale.size()) / tacke.size() : 0)
+
+    if (!pokreni(podskup))
+        return false;
+    for (auto &i : omotac)
+        i = preostale[i];
+    return true;
+}
+
+template <typename T>
+void geometrija::odbaciUnutrasnjeTacke(PogledTacaka2D<T> tacke, std::vector<uint32_t> &preostale)
+{
+    using S = Siroki<T>;
+
+    preostale.clear();
+    const auto n = tacke.size();
+    if (n == 0)
+        return;
+
+    const T *const x = tacke.x;
+    const T *const y = tacke.y;
+
+    /* Ekstremne vrednosti; samo min/max bez grananja, pa se petlja vektorizuje */
+    T minX = x[0], maxX = x[0], minY = y[0], maxY = y[0];
+    S minZbir = S(x[0]) + y[0], maxZbir = minZbir;
+    S minRazlika = S(x[0]) - y[0], maxRazlika = minRazlika;
+    for (size_t i = 1; i < n; i++) {
+        minX = std::min(minX, x[i]);
+        maxX = std::max(maxX, x[i]);
+        minY = std::min(minY, y[i]);
+        maxY = std::max(maxY, y[i]);
+        minZbir = std::min(minZbir, S(x[i]) + y[i]);
+        maxZbir = std::max(maxZbir, S(x[i]) + y[i]);
+        minRazlika = std::min(minRazlika, S(x[i]) - y[i]);
+        maxRazlika = std::max(maxRazlika, S(x[i]) - y[i]);
+    }
+
+    /* Po jedna tacka na svakom ekstremu, redom pravaca 0, 45, ..., 315 stepeni,
+     * sto je obilazak osmougla suprotno kazaljci na satu */
+    uint32_t e[8] = {};
+    for (uint32_t i = 0; i < n; i++) {
+        e[0] = x[i] == maxX ? i : e[0];
+        e[1] = S(x[i]) + y[i] == maxZbir ? i : e[1];
+        e[2] = y[i] == maxY ? i : e[2];
+        e[3] = S(x[i]) - y[i] == minRazlika ? i : e[3];
+        e[4] = x[i] == minX ? i : e[4];
+        e[5] = S(x[i]) + y[i] == minZbir ? i : e[5];
+        e[6] = y[i] == minY ? i : e[6];
+        e[7] = S(x[i]) - y[i] == maxRazlika ? i : e[7];
+    }
+
+    /* Stranice osmougla bez onih duzine 0 (ista tacka ekstremna u vise pravaca) */
+    T ax[8], ay[8], bx[8], by[8];
+    int m = 0;
+    for (int d = 0; d < 8; d++) {
+        const auto a = e[d], b = e[(d + 1) % 8];
+        if (x[a] == x[b] && y[a] == y[b])
+            continue;
+        ax[m] = x[a]; ay[m] = y[a];
+        bx[m] = x[b]; by[m] = y[b];
+        m++;
+    }
+
+    /* Sa manje od tri stranice osmougao nema unutrasnjost */
+    preostale.resize(n);
+    if (m < 3) {
+        std::iota(preostale.begin(), preostale.end(), 0);
+        return;
+    }
+
+    /* Nedostajuce stranice ponavljaju prvu, da bi unutrasnja petlja imala stalnu duzinu */
+    for (int d = m; d < 8; d++) {
+        ax[d] = ax[0]; ay[d] = ay[0];
+        bx[d] = bx[0]; by[d] = by[0];
+    }
+
+    /* Tacka ostaje ako nije strogo levo od svake stranice; upis bez grananja */
+    size_t k = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        bool unutra = true;
+        for (int d = 0; d < 8; d++)
+            unutra &= povrsinaTrougla<T>(ax[d], ay[d], bx[d], by[d], x[i], y[i]) > 0;
+        preostale[k] = i;
+        k += !unutra;
+    }
+    preostale.resize(k);
+}
+
+template <typename T>
+bool geometrija::gremovOmotac(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+                              Posmatrac *posmatrac)
+{
+    omotac.clear();
+    const auto n = tacke.size();
+    if (n == 0)
+        return true;
+
+    const T *const x = tacke.x;
+    const T *const y = tacke.y;
+
+    Posmatrac_faza(posmatrac, "maksimalna-tacka")
+    uint32_t max = 0;
+    for (uint32_t i = 1; i < n; i++) {
+        if (x[i] > x[max] || (x[i] == x[max] && y[i] < y[max]))
+            max = i;
+    }
+    Posmatrac_korak(posmatrac)
+
+    /* Sortira se permutacija indeksa, a ne same tacke */
+    Posmatrac_faza(posmatrac, "sortiranje")
+    std::vector<uint32_t> redosled(n);
+    std::iota(redosled.begin(), redosled.end(), 0);
+    std::sort(redosled.begin(), redosled.end(), [&](uint32_t lhs, uint32_t rhs) {
+        const auto P = povrsinaTrougla<T>(x[max], y[max], x[lhs], y[lhs], x[rhs], y[rhs]);
+        return (P < 0) || (P == 0 && distanceKvadrat<T>(x[max], y[max], x[lhs], y[lhs])
+                                     < distanceKvadrat<T>(x[max], y[max], x[rhs], y[rhs]));
+    });
+
+    Posmatrac_faza(posmatrac, "skeniranje")
+    omotac.push_back(max);
+    if (n > 1)
+        omotac.push_back(redosled[1]);
+
+    size_t j = 2;
+    while (j < n) {
+        const auto pom = omotac.size();
+        /* Sa manje od dva temena (npr. duplikati najvece tacke) nema sta da se odbaci */
+        if (pom < 2 || povrsinaTrougla<T>(x[omotac[pom-2]], y[omotac[pom-2]],
+                                          x[omotac[pom-1]], y[omotac[pom-1]],
+                                          x[redosled[j]], y[redosled[j]]) < 0)
+        {
+            omotac.push_back(redosled[j]);
+            ++j;
+        }
+        else {
+            omotac.pop_back();
+            // Ne smemo da povecamo j u ovom slucaju, jer nismo zavrsili sa ovom tackom
+        }
+        Posmatrac_korak(posmatrac)
+    }
+
+    omotac.push_back(max);
+    Posmatrac_korak(posmatrac)
+    return true;
+}
+
+template <typename T>
+bool geometrija::monotoniLanac(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+                               Posmatrac *posmatrac)
+{
+    omotac.clear();
+    const auto n = tacke.size();
+    if (n == 0)
+        return true;
+
+    const T *const x = tacke.x;
+    const T *const y = tacke.y;
+
+    Posmatrac_faza(posmatrac, "sortiranje")
+    std::vector<uint32_t> redosled;
+    leksikografskiRedosled(x, y, n, redosled);
+    Posmatrac_korak(posmatrac)
+
+    /* Gornji lanac (i = 0..n-1) pa donji (unazad do prve tacke), u istom
+     * steku; oba zadrzavaju samo skretanja udesno, kao Gremov algoritam.
+     * Donji lanac ne sme da odbaci temena gornjeg, pa ima svoje dno. */
+    Posmatrac_faza(posmatrac, "skeniranje")
+    size_t dno = 0;
+    for (size_t i = 0; i < 2*n - 1; i++) {
+        if (i == n)
+            dno = omotac.size() - 1;
+        const auto k = redosled[i < n ? i : 2*n - 2 - i];
+
+        while (omotac.size() >= dno + 2) {
+            const auto pom = omotac.size();
+            if (povrsinaTrougla<T>(x[omotac[pom-2]], y[omotac[pom-2]],
+                                   x[omotac[pom-1]], y[omotac[pom-1]], x[k], y[k]) < 0)
+                break;
+            omotac.pop_back();
+            Posmatrac_korak(posmatrac)
+        }
+        omotac.push_back(k);
+        Posmatrac_korak(posmatrac)
+    }
+    if (n == 1)
+        omotac.push_back(omotac.front());
+
+    /* Obilazak pocinje od najmanje tacke */
+    pocniOdNajvece(x, y, omotac);
+    Posmatrac_korak(posmatrac)
+    return true;
+}
+
+template <typename T>
+bool geometrija::cenovOmotac(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+                             Posmatrac *posmatrac)
+{
+    omotac.clear();
+    const auto n = tacke.size();
+    if (n == 0)
+        return true;
+
+    const T *const x = tacke.x;
+    const T *const y = tacke.y;
+
+    /* Pocetak je isti kao kod Gremovog algoritma */
+    uint32_t max = 0;
+    for (uint32_t i = 1; i < n; i++) {
+        if (x[i] > x[max] || (x[i] == x[max] && y[i] < y[max]))
+            max = i;
+    }
+
+    /* Omotaci grupa u jednom nizu; grupa g je temena [pocetak[g], pocetak[g+1]) */
+    std::vector<uint32_t> temena, pocetak, grupa;
+
+    for (unsigned stepen = CEN_POCETNI_STEPEN; ; stepen++) {
+        const unsigned eksponent = 1u << stepen;
+        const size_t m = eksponent >= 32 ? n : std::min<size_t>(n, size_t(1) << eksponent);
+
+        Posmatrac_faza(posmatrac, "omotaci-grupa")
+        temena.clear();
+        pocetak.assign(1, 0);
+        for (size_t od = 0; od < n; od += m) {
+            const auto duzina = std::min(m, n - od);
+            gremovOmotac(PogledTacaka2D<T>(x + od, y + od, duzina), grupa);
+            /* Bez ponovljenog prvog temena, u indeksima ulaza */
+            for (size_t i = 0; i + 1 < grupa.size(); i++)
+                temena.push_back(static_cast<uint32_t>(od + grupa[i]));
+            pocetak.push_back(static_cast<uint32_t>(temena.size()));
+        }
+        Posmatrac_korak(posmatrac)
+
+        /* Umotavanje: najvise m temena; inace je m premalo */
+        Posmatrac_faza(posmatrac, "umotavanje")
+        omotac.assign(1, max);
+        bool zatvoren = false;
+        for (size_t korak = 0; korak < m && !zatvoren; korak++) {
+            const auto p = omotac.back();
+            auto sledece = p;
+            for (size_t g = 0; g + 1 < pocetak.size(); g++) {
+                if (pocetak[g] == pocetak[g+1])
+                    continue;
+                const auto kandidat = tangenta(x, y, p, temena.data() + pocetak[g],
+                                               pocetak[g+1] - pocetak[g]);
+                if (bolja(x, y, p, sledece, kandidat))
+                    sledece = kandidat;
+            }
+
+            /* Sve tacke su jednake p, ili se obilazak vratio na pocetak */
+            zatvoren = sledece == p || (x[sledece] == x[max] && y[sledece] == y[max]);
+            omotac.push_back(zatvoren ? max : sledece);
+            Posmatrac_korak(posmatrac)
+        }
+
+        if (zatvoren)
+            return true;
+    }
+}
+
+template <typename T>
+bool geometrija::paralelniOmotac(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+                                 unsigned brojNiti, Posmatrac *posmatrac)
+{
+    omotac.clear();
+    const auto n = tacke.size();
+    if (n == 0)
+        return true;
+
+    const T *const x = tacke.x;
+    const T *const y = tacke.y;
+
+    if (brojNiti == 0)
+        brojNiti = std::max(1u, std::thread::hardware_concurrency());
+    const auto k = static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(brojNiti, n / MIN_TACAKA_PO_NITI)));
+
+    /* Granice pojaseva iz ravnomernog uzorka x koordinata; pojas tacke je broj
+     * granica koje nisu vece od njenog x, pa su pojasevi razdvojeni po x */
+    Posmatrac_faza(posmatrac, "podela")
+    std::vector<T> granice;
+    {
+        const size_t s = std::min<size_t>(n, k * UZORAK_PO_POJASU);
+        std::vector<T> uzorak(s);
+        for (size_t i = 0; i < s; i++)
+            uzorak[i] = x[i * n / s];
+        std::sort(uzorak.begin(), uzorak.end());
+        for (unsigned p = 1; p < k; p++)
+            granice.push_back(uzorak[p * s / k]);
+    }
+    const auto pojas = [&](size_t i) {
+        return static_cast<size_t>(std::upper_bound(granice.begin(), granice.end(), x[i]) - granice.begin());
+    };
+
+    /* Nit d broji tacke svog dela ulaza po pojasevima, pa ih prepisuje na
+     * svoje mesto unutar svakog pojasa; brojevi[d*k + p] su tacke dela d u pojasu p */
+    std::vector<size_t> brojevi(size_t(k) * k);
+    uNitima(k, [&](unsigned d) {
+        for (size_t i = d * n / k; i < (d + 1) * n / k; i++)
+            brojevi[d*k + pojas(i)]++;
+    });
+
+    std::vector<size_t> pocetakPojasa(k + 1), pozicije(size_t(k) * k);
+    size_t pozicija = 0;
+    for (unsigned p = 0; p < k; p++) {
+        pocetakPojasa[p] = pozicija;
+        for (unsigned d = 0; d < k; d++) {
+            pozicije[d*k + p] = pozicija;
+            pozicija += brojevi[d*k + p];
+        }
+    }
+    pocetakPojasa[k] = n;
+
+    std::vector<T> px(n), py(n);
+    std::vector<uint32_t> pi(n);
+    uNitima(k, [&](unsigned d) {
+        std::vector<size_t> poz(pozicije.begin() + d*k, pozicije.begin() + (d + 1)*k);
+        for (size_t i = d * n / k; i < (d + 1) * n / k; i++) {
+            const auto j = poz[pojas(i)]++;
+            px[j] = x[i];
+            py[j] = y[i];
+            pi[j] = static_cast<uint32_t>(i);
+        }
+    });
+    Posmatrac_korak(posmatrac)
+
+    /* Omotac svakog pojasa (monotoni lanac) u svojoj niti */
+    Posmatrac_faza(posmatrac, "omotaci-pojaseva")
+    std::vector<Lanci> lanci(k);
+    uNitima(k, [&](unsigned p) {
+        const auto od = pocetakPojasa[p];
+        const auto duzina = pocetakPojasa[p+1] - od;
+        if (duzina == 0)
+            return;
+
+        std::vector<uint32_t> redosled;
+        leksikografskiRedosled(px.data() + od, py.data() + od, duzina, redosled);
+        napraviLance(px.data() + od, py.data() + od, redosled, lanci[p]);
+        for (auto &i : lanci[p].gornji)
+            i = pi[od + i];
+        for (auto &i : lanci[p].donji)
+            i = pi[od + i];
+    });
+    Posmatrac_korak(posmatrac)
+
+    /* Spajanje omotaca susednih pojaseva sleva nadesno, mostovima */
+    Posmatrac_faza(posmatrac, "spajanje")
+    Lanci ukupno;
+    for (auto &l : lanci) {
+        if (l.gornji.empty())
+            continue;
+        if (ukupno.gornji.empty()) {
+            ukupno = std::move(l);
+            continue;
+        }
+        spojiLance(x, y, ukupno.gornji, l.gornji, true);
+        spojiLance(x, y, ukupno.donji, l.donji, false);
+    }
+
+    omotacIzLanaca(x, y, ukupno, omotac);
+    Posmatrac_korak(posmatrac)
+    return true;
+}
+
+template <typename T>
+void geometrija::paketniOmotaci(PogledTacaka2D<T> tacke, const std::vector<uint32_t> &pocetak,
+                                std::vector<uint32_t> &omotaci, std::vector<uint32_t> &pocetakOmotaca,
+                                unsigned brojNiti)
+{
+    const size_t brojSkupova = pocetak.empty() ? 0 : pocetak.size() - 1;
+    omotaci.clear();
+    pocetakOmotaca.assign(brojSkupova + 1, 0);
+    if (brojSkupova == 0)
+        return;
+
+    const T *const x = tacke.x;
+    const T *const y = tacke.y;
+
+    if (brojNiti == 0)
+        brojNiti = std::max(1u, std::thread::hardware_concurrency());
+    const auto k = static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(
+        {size_t(brojNiti), tacke.size() / MIN_TACAKA_PO_NITI, (brojSkupova + BLOK_SKUPOVA - 1) / BLOK_SKUPOVA})));
+
+    /* Niti uzimaju blokove skupova redom, dok ih ima, pa velicine skupova ne
+     * moraju biti ujednacene. Omotaci se upisuju u izlaz niti, a duzina omotaca
+     * skupa s u pocetakOmotaca[s + 1]. */
+    std::atomic<size_t> sledeciBlok(0);
+    std::vector<std::vector<uint32_t>> izlazNiti(k), blokoviNiti(k);
+    uNitima(k, [&](unsigned d) {
+        RadniNizovi<T> r;
+        for (;;) {
+            const auto blok = sledeciBlok.fetch_add(1, std::memory_order_relaxed);
+            const auto od = blok * BLOK_SKUPOVA;
+            if (od >= brojSkupova)
+                break;
+            blokoviNiti[d].push_back(static_cast<uint32_t>(blok));
+            for (auto s = od; s < std::min(od + BLOK_SKUPOVA, brojSkupova); s++) {
+                const auto p = pocetak[s];
+                omotacSkupa(x + p, y + p, pocetak[s+1] - p, r);
+                izlazNiti[d].insert(izlazNiti[d].end(), r.omotac.begin(), r.omotac.end());
+                pocetakOmotaca[s+1] = static_cast<uint32_t>(r.omotac.size());
+            }
+        }
+    });
+
+    for (size_t s = 0; s < brojSkupova; s++)
+        pocetakOmotaca[s+1] += pocetakOmotaca[s];
+    omotaci.resize(pocetakOmotaca[brojSkupova]);
+
+    /* Svaka nit prepisuje svoje omotace na konacno mesto, uz prevodjenje
+     * indeksa unutar skupa u indekse ulaza */
+    uNitima(k, [&](unsigned d) {
+        const uint32_t *izvor = izlazNiti[d].data();
+        for (auto blok : blokoviNiti[d]) {
+            const size_t od = size_t(blok) * BLOK_SKUPOVA;
+            for (auto s = od; s < std::min(od + BLOK_SKUPOVA, brojSkupova); s++) {
+                for (auto i = pocetakOmotaca[s]; i < pocetakOmotaca[s+1]; i++)
+                    omotaci[i] = pocetak[s] + *izvor++;
+            }
+        }
+    });
+}
+
+template <typename T>
+bool geometrija::quickhull(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac, Posmatrac *posmatrac)
+{
+    omotac.clear();
+    const auto n = tacke.size();
+    if (n == 0)
+        return true;
+
+    const T *const x = tacke.x;
+    const T *const y = tacke.y;
+
+    /* Leksikografski najmanja i najveca tacka su temena omotaca */
+    Posmatrac_faza(posmatrac, "krajnje-tacke")
+    const T minX = *std::min_element(x, x + n);
+    const T maxX = *std::max_element(x, x + n);
+    uint32_t a = 0, b = 0;
+    bool imaA = false, imaB = false;
+    for (uint32_t i = 0; i < n; i++) {
+        const bool boljeA = x[i] == minX && (!imaA || y[i] < y[a]);
+        const bool boljeB = x[i] == maxX && (!imaB || y[i] > y[b]);
+        a = boljeA ? i : a;
+        b = boljeB ? i : b;
+        imaA = imaA || boljeA;
+        imaB = imaB || boljeB;
+    }
+    omotac.push_back(a);
+    if (x[a] == x[b] && y[a] == y[b]) {
+        omotac.push_back(a);
+        return true;
+    }
+    Posmatrac_korak(posmatrac)
+
+    /* Tacke iznad AB idu na pocetak prvog bafera, a ispod na kraj */
+    Posmatrac_faza(posmatrac, "podela")
+    NizoviTacaka<T> bafer[2] = {NizoviTacaka<T>(n), NizoviTacaka<T>(n)};
+    {
+        std::vector<uint32_t> indeksi(n);
+        std::iota(indeksi.begin(), indeksi.end(), 0);
+        const auto strane = podeli(x, y, indeksi.data(), n,
+                                   x[a], y[a], x[b], y[b], x[b], y[b], x[a], y[a],
+                                   bafer[0].x.data(), bafer[0].y.data(), bafer[0].i.data());
+
+        /* Omotac je a, lanac od a do b, b, pa lanac od b do a; zadaci se
+         * obradjuju redom kojim daju temena, pa se na stek stavljaju obrnuto */
+        struct Zadatak {
+            uint32_t a, b;
+            size_t od, n;
+            unsigned bafer;
+            bool teme;  /* samo se dodaje teme a */
+        };
+        std::vector<Zadatak> stek;
+        stek.push_back({b, a, n - strane.second, strane.second, 0, false});
+        stek.push_back({b, b, 0, 0, 0, true});
+        stek.push_back({a, b, 0, strane.first, 0, false});
+
+        while (!stek.empty()) {
+            const auto z = stek.back();
+            stek.pop_back();
+            if (z.teme) {
+                omotac.push_back(z.a);
+                Posmatrac_korak(posmatrac)
+                continue;
+            }
+            if (z.n == 0)
+                continue;
+
+            /* Najdalja tacka c od AB je teme; tacke levo od AC i levo od CB
+             * prelaze u drugi bafer, na isti opseg, a ostale su unutar ABC */
+            const auto &izvor = bafer[z.bafer];
+            auto &odrediste = bafer[1 - z.bafer];
+            const T *const ix = izvor.x.data() + z.od;
+            const T *const iy = izvor.y.data() + z.od;
+            const auto k = najdaljaTacka(ix, iy, z.n, x[z.a], y[z.a], x[z.b], y[z.b]);
+            const auto c = izvor.i[z.od + k];
+
+            const auto delovi = podeli(ix, iy, izvor.i.data() + z.od, z.n,
+                                       x[z.a], y[z.a], x[c], y[c], x[c], y[c], x[z.b], y[z.b],
+                                       odrediste.x.data() + z.od, odrediste.y.data() + z.od,
+                                       odrediste.i.data() + z.od);
+            stek.push_back({c, z.b, z.od + z.n - delovi.second, delovi.second, 1 - z.bafer, false});
+            stek.push_back({c, c, 0, 0, 0, true});
+            stek.push_back({z.a, c, z.od, delovi.first, 1 - z.bafer, false});
+        }
+    }
+
+    omotac.push_back(a);
+    pocniOdNajvece(x, y, omotac);
+    Posmatrac_korak(posmatrac)
+    return true;
+}
+
+template bool geometrija::konveksniOmotac<int32_t>(PogledTacaka2D<int32_t>, std::vector<uint32_t> &,
+                                                  const ParametriOmotaca &, Posmatrac *);
+template void geometrija::odbaciUnutrasnjeTacke<int32_t>(PogledTacaka2D<int32_t>, std::vector<uint32_t> &);
+template bool geometrija::monotoniLanac<int32_t>(PogledTacaka2D<int32_t>, std::vector<uint32_t> &, Posmatrac *);
+template bool geometrija::cenovOmotac<int32_t>(PogledTacaka2D<int32_t>, std::vector<uint32_t> &, Posmatrac *);
+template bool geometrija::paralelniOmotac<int32_t>(PogledTacaka2D<int32_t>, std::vector<uint32_t> &, unsigned,
+                                                   Posmatrac *);
+template bool geometrija::gremovOmotac<int32_t>(PogledTacaka2D<int32_t>, std::vector<uint32_t> &, Posmatrac *);
+template bool geometrija::quickhull<int32_t>(PogledTacaka2D<int32_t>, std::vector<uint32_t> &, Posmatrac *);
+template void geometrija::paketniOmotaci<int32_t>(PogledTacaka2D<int32_t>, const std::vector<uint32_t> &,
+                                             std::vector<uint32_t> &, std::vector<uint32_t> &, unsigned);
+#ifdef __SIZEOF_INT128__
+template bool geometrija::konveksniOmotac<int64_t>(PogledTacaka2D<int64_t>, std::vector<uint32_t> &,
+                                                  const ParametriOmotaca &, Posmatrac *);
+template void geometrija::odbaciUnutrasnjeTacke<int64_t>(PogledTacaka2D<int64_t>, std::vector<uint32_t> &);
+template bool geometrija::monotoniLanac<int64_t>(PogledTacaka2D<int64_t>, std::vector<uint32_t> &, Posmatrac *);
+template bool geometrija::cenovOmotac<int64_t>(PogledTacaka2D<int64_t>, std::vector<uint32_t> &, Posmatrac *);
+template bool geometrija::paralelniOmotac<int64_t>(PogledTacaka2D<int64_t>, std::vector<uint32_t> &, unsigned,
+                                                   Posmatrac *);
+template bool geometrija::gremovOmotac<int64_t>(PogledTacaka2D<int64_t>, std::vector<uint32_t> &, Posmatrac *);
+template bool geometrija::quickhull<int64_t>(PogledTacaka2D<int64_t>, std::vector<uint32_t> &, Posmatrac *);
+template void geometrija::paketniOmotaci<int64_t>(PogledTacaka2D<int64_t>, const std::vector<uint32_t> &,
+                                             std::vector<uint32_t> &, std::vector<uint32_t> &, unsigned);
+#endif
@@ -0,0 +1,142 @@
+#ifndef GA_CORE_KONVEKSNIOMOTAC2D_H
+#define GA_CORE_KONVEKSNIOMOTAC2D_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "posmatrac.h"
+#include "tacke.h"
+
+namespace geometrija {
+
+/* Algoritam kojim se racuna omotac; svi daju isti oblik izlaza */
+enum class StrategijaOmotaca {
+    GREM,               /* sortiranje po uglu oko krajnje tacke */
+    MONOTONI_LANAC,     /* leksikografsko (radix) sortiranje, gornji i donji lanac */
+    CEN,                /* Cenov algoritam, O(n log h) */
+    PARALELNI,          /* podeli pa vladaj u vise niti */
+    DINAMICKI,          /* umetanje tacku po tacku u DinamickiOmotac */
+    QUICKHULL,          /* podela prema najdaljoj tacki, O(n log n) u proseku */
+    BROJ_STRATEGIJA
+};
+
+const char *imeStrategije(StrategijaOmotaca strategija);
+bool strategijaIzImena(const std::string &ime, StrategijaOmotaca &strategija);
+
+struct ParametriOmotaca {
+    StrategijaOmotaca strategija = StrategijaOmotaca::GREM;
+
+    /* Akl-Tusenovo odbacivanje unutrasnjih tacaka (odbaciUnutrasnjeTacke) pre algoritma */
+    bool odbacivanjeUnutrasnjih = false;
+
+    /* Broj niti paralelnog omotaca; 0 znaci broj jezgara */
+    unsigned brojNiti = 0;
+};
+
+///
+/// \brief konveksniOmotac - omotac algoritmom zadatim u parametrima
+///     (gremovOmotac, monotoniLanac, cenovOmotac, paralelniOmotac, dinamickiOmotac,
+///     quickhull); parametri kao
+///     kod gremovOmotac.
+///     Uz odbacivanje unutrasnjih tacaka algoritam radi nad preostalim tackama,
+///     pa posmatrac do kraja izvrsavanja vidi indekse medju njima; tek gotov
+///     omotac se prevodi u indekse ulaza. Faza "odbacivanje" prijavljuje udeo
+///     odbacenih tacaka.
+///
+template <typename T>
+bool konveksniOmotac(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+                     const ParametriOmotaca &parametri, Posmatrac *posmatrac = nullptr);
+
+///
+/// \brief gremovOmotac - Gremov algoritam nad celobrojnim koordinatama, O(n log n):
+///     tacke se sortiraju po uglu oko tacke sa najvecom x koordinatom, pa se
+///     jednim prolazom odbacuju one koje ne prave skretanje u istom smeru.
+/// \param tacke - ulaz; T je int32_t ili int64_t (vidi Siroki<T>)
+/// \param omotac - izlaz: indeksi temena omotaca, pri cemu je prvo teme ponovljeno
+///     na kraju (isti oblik kao KonveksniOmotac::getKonveksniOmotac)
+/// \param posmatrac - animacija i merenje faza; nullptr ako ih nema
+/// \return false ako je posmatrac prekinuo izvrsavanje
+///
+template <typename T>
+bool gremovOmotac(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+                  Posmatrac *posmatrac = nullptr);
+
+///
+/// \brief odbaciUnutrasnjeTacke - Akl-Tusenova heuristika: nalaze se ekstremne
+///     tacke u 8 pravaca (x, y, x + y, x - y, oba smera) i odbacuju sve tacke
+///     strogo unutar osmougla koji one odredjuju, jer ne mogu biti temena omotaca.
+///     Ekstremi se traze jednim prolazom bez grananja, koji se vektorizuje.
+/// \param preostale - izlaz: rastuci indeksi tacaka koje nisu odbacene
+///
+template <typename T>
+void odbaciUnutrasnjeTacke(PogledTacaka2D<T> tacke, std::vector<uint32_t> &preostale);
+
+///
+/// \brief monotoniLanac - Endruov algoritam (monotoni lanac), O(n log n) samo
+///     zbog sortiranja: tacke se leksikografski sortiraju radix sortiranjem (bez
+///     poredjenja uglova), pa se gradi gornji lanac sleva nadesno i donji zdesna
+///     nalevo. Izlaz je isti kao kod gremovOmotac (isti smer obilaska i prvo teme).
+///
+template <typename T>
+bool monotoniLanac(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+                   Posmatrac *posmatrac = nullptr);
+
+///
+/// \brief cenovOmotac - Cenov (T. Chan) algoritam, O(n log h) za omotac sa h temena:
+///     tacke se dele u grupe od m tacaka, omotac svake grupe se racuna Gremovim
+///     algoritmom, pa se ukupni omotac umotava (Dzarvis), pri cemu se sledece teme
+///     u svakoj grupi trazi binarnom pretragom tangente. Ako umotavanje ne zavrsi
+///     u m koraka, ponavlja se sa m^2 (m = 16, 256, 65536, ...).
+///     Izlaz je isti kao kod gremovOmotac.
+///
+template <typename T>
+bool cenovOmotac(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+                 Posmatrac *posmatrac = nullptr);
+
+///
+/// \brief paralelniOmotac - podeli pa vladaj u brojNiti niti (0 = broj jezgara):
+///     tacke se po x dele u pojaseve (granice iz uzorka), niti paralelno prepisuju
+///     tacke u pojaseve i racunaju omotac svakog pojasa monotonim lancem, a omotaci
+///     susednih pojaseva se spajaju preko gornje i donje zajednicke tangente.
+///     Svaka nit dobija bar 2^15 tacaka, pa mali ulazi rade u jednoj niti.
+///     Posmatrac se poziva samo iz niti pozivaoca, izmedju faza.
+///     Izlaz je isti kao kod gremovOmotac.
+///
+template <typename T>
+bool paralelniOmotac(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+                     unsigned brojNiti = 0, Posmatrac *posmatrac = nullptr);
+
+///
+/// \brief quickhull - Quickhull: za duz AB izmedju dva temena nalazi se najdalja
+///     tacka C levo od nje, koja je teme, pa se isto ponavlja za tacke levo od AC
+///     i levo od CB, a tacke unutar ABC se odbacuju. Tacke su u zasebnim nizovima
+///     koordinata (dva bafera, podskupovi na istim opsezima), a trazenje najdalje
+///     tacke i podela su prolazi bez grananja koji se vektorizuju. Zadaci su na
+///     eksplicitnom steku, pa dubina podele ne zavisi od steka niti.
+///     O(n log n) u proseku, O(nh) u najgorem slucaju. Izlaz je isti kao kod
+///     gremovOmotac.
+///
+template <typename T>
+bool quickhull(PogledTacaka2D<T> tacke, std::vector<uint32_t> &omotac,
+               Posmatrac *posmatrac = nullptr);
+
+///
+/// \brief paketniOmotaci - omotaci mnogo nezavisnih (obicno malih) skupova tacaka
+///     jednim pozivom, u brojNiti niti (0 = broj jezgara): niti uzimaju blokove
+///     skupova redom i racunaju omotac svakog monotonim lancem, uz radne nizove
+///     koji se cuvaju izmedju skupova, pa po skupu nema alokacija.
+/// \param tacke - tacke svih skupova, jedan skup za drugim
+/// \param pocetak - brojSkupova + 1 pomeraja: skup s su tacke [pocetak[s], pocetak[s+1])
+/// \param omotaci - izlaz: indeksi u tacke; omotac skupa s je
+///     [pocetakOmotaca[s], pocetakOmotaca[s+1]), u obliku kao kod gremovOmotac
+/// \param pocetakOmotaca - izlaz: brojSkupova + 1 pomeraja u omotaci
+///
+template <typename T>
+void paketniOmotaci(PogledTacaka2D<T> tacke, const std::vector<uint32_t> &pocetak,
+                    std::vector<uint32_t> &omotaci, std::vector<uint32_t> &pocetakOmotaca,
+                    unsigned brojNiti = 0);
+
+}
+
+#endif // GA_CORE_KONVEKSNIOMOTAC2D_H
@@ -0,0 +1,389 @@
+#include "konveksniomotac3d.h"
+#include "paketnipredikati.h"
+#include "predikati.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+const uint32_t NEMA = std::numeric_limits<uint32_t>::max();
+
+/* Stranica omotaca, sa temenima poredjanim tako da su tacke omotaca sa pozitivne
+ * strane (orijentacija3D > 0); sused[i] je stranica preko ivice v[i] -> v[i+1] */
+struct Stranica {
+    uint32_t v[3];
+    uint32_t sused[3];
+    bool ziva;
+
+    /* Tacke izvan stranice (orijentacija3D < 0) i najdalja od njih */
+    std::vector<uint32_t> spoljne;
+    uint32_t najdalja;
+
+    /* Poslednje dodavanje u kome je stranica posecena, i da li je tada bila vidljiva */
+    uint32_t poseta;
+    bool vidljiva;
+};
+
+/* Ivica horizonta: a -> b u smeru obrisane stranice, i stranica sa druge strane */
+struct IvicaHorizonta {
+    uint32_t a, b;
+    uint32_t spolja;
+};
+
+class Quickhull3D
+{
+public:
+    explicit Quickhull3D(geometrija::PogledTacaka3D<double> tacke);
+
+    bool pocetniTetraedar();
+    bool imaSpoljnih() const { return !_naRedu.empty(); }
+
+    /* Dodaje najdalju tacku sledece stranice na redu; false ako stranica u
+     * medjuvremenu vise nema spoljnih tacaka */
+    bool dodajSledece();
+
+    void trouglovi(std::vector<uint32_t> &trouglovi) const;
+
+private:
+    uint32_t novaStranica(uint32_t a, uint32_t b, uint32_t c);
+    void ukloni(uint32_t s);
+    bool vidljiva(uint32_t s, uint32_t oko);
+    void koordinate(uint32_t t, double p[3]) const;
+
+    /* Kandidati su prvih m mesta u nizovima _kx, _ky, _kz, _ki */
+    void rasporedi(size_t m, const std::vector<uint32_t> &nove);
+
+    geometrija::PogledTacaka3D<double> _tacke;
+    std::vector<Stranica> _stranice;
+    std::vector<uint32_t> _slobodne;
+    std::vector<uint32_t> _naRedu;
+    uint32_t _poseta = 0;
+
+    /* Radni nizovi: kandidati za raspodelu, pa stranica nove temena po temenu horizonta */
+    std::vector<double> _kx, _ky, _kz, _udaljenost;
+    std::vector<uint32_t> _ki;
+    std::vector<int8_t> _znakovi;
+    std::vector<uint32_t> _poTemenu;
+
+    std::vector<uint32_t> _vidljive, _stek, _nove;
+    std::vector<IvicaHorizonta> _horizont;
+};
+
+Quickhull3D::Quickhull3D(geometrija::PogledTacaka3D<double> tacke)
+    : _tacke(tacke),
+      _kx(tacke.size()), _ky(tacke.size()), _kz(tacke.size()), _udaljenost(tacke.size()),
+      _ki(tacke.size()), _znakovi(tacke.size()), _poTemenu(tacke.size(), NEMA)
+{}
+
+void Quickhull3D::koordinate(uint32_t t, double p[3]) const
+{
+    p[0] = _tacke.x[t];
+    p[1] = _tacke.y[t];
+    p[2] = _tacke.z[t];
+}
+
+bool Quickhull3D::pocetniTetraedar()
+{
+    const auto n = _tacke.size();
+    const double *const x = _tacke.x;
+    const double *const y = _tacke.y;
+    const double *const z = _tacke.z;
+    if (n < 4)
+        return false;
+
+    /* Priblizno krajnje tacke: najmanji x, najdalja od nje, najdalja od prave
+     * kroz njih i najdalja od ravni kroz sve tri; priblizan izbor se proverava
+     * tacnim predikatom, a ako ne prodje uzima se prva odgovarajuca tacka */
+    const auto t0 = static_cast<uint32_t>(std::min_element(x, x + n) - x);
+
+    uint32_t t1 = 0;
+    double najvise = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        const double dx = x[i] - x[t0], dy = y[i] - y[t0], dz = z[i] - z[t0];
+        const double d = dx*dx + dy*dy + dz*dz;
+        t1 = d > najvise ? i : t1;
+        najvise = std::max(najvise, d);
+    }
+    if (najvise == 0)
+        return false;
+
+    const auto kolinearne = [&](uint32_t i) {
+        return geometrija::orijentacija(x[t0], y[t0], x[t1], y[t1], x[i], y[i]) == 0 &&
+               geometrija::orijentacija(y[t0], z[t0], y[t1], z[t1], y[i], z[i]) == 0 &&
+               geometrija::orijentacija(z[t0], x[t0], z[t1], x[t1], z[i], x[i]) == 0;
+    };
+    uint32_t t2 = 0;
+    najvise = 0;
+    {
+        const double ux = x[t1] - x[t0], uy = y[t1] - y[t0], uz = z[t1] - z[t0];
+        for (uint32_t i = 0; i < n; i++) {
+            const double wx = x[i] - x[t0], wy = y[i] - y[t0], wz = z[i] - z[t0];
+            const double cx = uy*wz - uz*wy, cy = uz*wx - ux*wz, cz = ux*wy - uy*wx;
+            const double d = cx*cx + cy*cy + cz*cz;
+            t2 = d > najvise ? i : t2;
+            najvise = std::max(najvise, d);
+        }
+    }
+    if (kolinearne(t2)) {
+        for (t2 = 0; t2 < n && kolinearne(t2); t2++)
+            ;
+        if (t2 == n)
+            return false;
+    }
+
+    double a[3], b[3], c[3];
+    koordinate(t0, a);
+    koordinate(t1, b);
+    koordinate(t2, c);
+    uint32_t t3 = 0;
+    najvise = 0;
+    {
+        const double ux = b[0] - a[0], uy = b[1] - a[1], uz = b[2] - a[2];
+        const double wx = c[0] - a[0], wy = c[1] - a[1], wz = c[2] - a[2];
+        const double nx = uy*wz - uz*wy, ny = uz*wx - ux*wz, nz = ux*wy - uy*wx;
+        for (uint32_t i = 0; i < n; i++) {
+            const double d = std::abs(nx*(x[i] - a[0]) + ny*(y[i] - a[1]) + nz*(z[i] - a[2]));
+            t3 = d > najvise ? i : t3;
+            najvise = std::max(najvise, d);
+        }
+    }
+    if (geometrija::orijentacija3D(a[0], a[1], a[2], b[0], b[1], b[2], c[0], c[1], c[2],
+                                   x[t3], y[t3], z[t3]) == 0) {
+        t3 = static_cast<uint32_t>(geometrija::prvaOrijentacija3D(
+                a, b, c, x, y, z, n, geometrija::NEGATIVNA | geometrija::POZITIVNA));
+        if (t3 == n)
+            return false;
+    }
+
+    /* Unutrasnjost tetraedra mora biti sa pozitivne strane svake stranice */
+    if (geometrija::orijentacija3D(a[0], a[1], a[2], b[0], b[1], b[2], c[0], c[1], c[2],
+                                   x[t3], y[t3], z[t3]) < 0)
+        std::swap(t1, t2);
+
+    _nove.clear();
+    _nove.push_back(novaStranica(t0, t1, t2));
+    _nove.push_back(novaStranica(t0, t3, t1));
+    _nove.push_back(novaStranica(t0, t2, t3));
+    _nove.push_back(novaStranica(t1, t3, t2));
+    for (auto s : _nove)
+        for (unsigned i = 0; i < 3; i++)
+            for (auto r : _nove) {
+                const auto &p = _stranice[s], &q = _stranice[r];
+                for (unsigned j = 0; j < 3; j++)
+                    if (q.v[j] == p.v[(i + 1) % 3] && q.v[(j + 1) % 3] == p.v[i])
+                        _stranice[s].sused[i] = r;
+            }
+
+    /* Temena tetraedra nisu izvan nijedne stranice, pa se ne izdvajaju */
+    for (uint32_t i = 0; i < n; i++) {
+        _kx[i] = x[i];
+        _ky[i] = y[i];
+        _kz[i] = z[i];
+        _ki[i] = i;
+    }
+    rasporedi(n, _nove);
+    return true;
+}
+
+uint32_t Quickhull3D::novaStranica(uint32_t a, uint32_t b, uint32_t c)
+{
+    uint32_t s;
+    if (_slobodne.empty()) {
+        s = static_cast<uint32_t>(_stranice.size());
+        _stranice.emplace_back();
+    } else {
+        s = _slobodne.back();
+        _slobodne.pop_back();
+    }
+
+    auto &stranica = _stranice[s];
+    stranica.v[0] = a;
+    stranica.v[1] = b;
+    stranica.v[2] = c;
+    stranica.sused[0] = stranica.sused[1] = stranica.sused[2] = NEMA;
+    stranica.ziva = true;
+    stranica.spoljne.clear();
+    stranica.najdalja = NEMA;
+    stranica.poseta = 0;
+    stranica.vidljiva = false;
+    return s;
+}
+
+void Quickhull3D::ukloni(uint32_t s)
+{
+    /* Memorija spoljnih tacaka se oslobadja odmah, jer ih stranica vise ne cuva */
+    _stranice[s].ziva = false;
+    std::vector<uint32_t>().swap(_stranice[s].spoljne);
+    _slobodne.push_back(s);
+}
+
+bool Quickhull3D::vidljiva(uint32_t s, uint32_t oko)
+{
+    auto &stranica = _stranice[s];
+    if (stranica.poseta != _poseta) {
+        const auto a = stranica.v[0], b = stranica.v[1], c = stranica.v[2];
+        stranica.poseta = _poseta;
+        stranica.vidljiva = geometrija::orijentacija3D(
+                    _tacke.x[a], _tacke.y[a], _tacke.z[a], _tacke.x[b], _tacke.y[b], _tacke.z[b],
+                    _tacke.x[c], _tacke.y[c], _tacke.z[c], _tacke.x[oko], _tacke.y[oko], _tacke.z[oko]) < 0;
+    }
+    return stranica.vidljiva;
+}
+
+void Quickhull3D::rasporedi(size_t m, const std::vector<uint32_t> &nove)
+{
+    for (auto s : nove) {
+        if (m == 0)
+            break;
+
+        double a[3], b[3], c[3];
+        koordinate(_stranice[s].v[0], a);
+        koordinate(_stranice[s].v[1], b);
+        koordinate(_stranice[s].v[2], c);
+        geometrija::znakoviOrijentacije3D(a, b, c, _kx.data(), _ky.data(), _kz.data(), m, _znakovi.data());
+
+        /* Udaljenost od ravni, do na duzinu normale; orijentacija3D je -n.(p - a) */
+        const double ux = b[0] - a[0], uy = b[1] - a[1], uz = b[2] - a[2];
+        const double wx = c[0] - a[0], wy = c[1] - a[1], wz = c[2] - a[2];
+        const double nx = uy*wz - uz*wy, ny = uz*wx - ux*wz, nz = ux*wy - uy*wx;
+        for (size_t i = 0; i < m; i++)
+            _udaljenost[i] = nx*(_kx[i] - a[0]) + ny*(_ky[i] - a[1]) + nz*(_kz[i] - a[2]);
+
+        size_t najdalja = m;
+        double najvise = -std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < m; i++) {
+            const bool bolja = _znakovi[i] < 0 && _udaljenost[i] > najvise;
+            najdalja = bolja ? i : najdalja;
+            najvise = bolja ? _udaljenost[i] : najvise;
+        }
+        if (najdalja == m)
+            continue;
+
+        /* Spoljne tacke pripadaju stranici, a ostale ostaju kandidati za sledece */
+        auto &stranica = _stranice[s];
+        stranica.najdalja = _ki[najdalja];
+        size_t ostalo = 0;
+        for (size_t i = 0; i < m; i++) {
+            if (_znakovi[i] < 0) {
+                stranica.spoljne.push_back(_ki[i]);
+                continue;
+            }
+            _kx[ostalo] = _kx[i];
+            _ky[ostalo] = _ky[i];
+            _kz[ostalo] = _kz[i];
+            _ki[ostalo] = _ki[i];
+            ostalo++;
+        }
+        m = ostalo;
+        _naRedu.push_back(s);
+    }
+}
+
+bool Quickhull3D::dodajSledece()
+{
+    const auto pocetna = _naRedu.back();
+    _naRedu.pop_back();
+    if (!_stranice[pocetna].ziva || _stranice[pocetna].spoljne.empty())
+        return false;
+    const auto oko = _stranice[pocetna].najdalja;
+
+    /* Vidljive stranice cine povezanu oblast oko pocetne; njena granica je
+     * horizont, izmedju vidljive i nevidljive stranice */
+    _poseta++;
+    _stranice[pocetna].poseta = _poseta;
+    _stranice[pocetna].vidljiva = true;
+    _vidljive.assign(1, pocetna);
+    _stek.assign(1, pocetna);
+    _horizont.clear();
+    while (!_stek.empty()) {
+        const auto s = _stek.back();
+        _stek.pop_back();
+        for (unsigned i = 0; i < 3; i++) {
+            const auto r = _stranice[s].sused[i];
+            const bool posecena = _stranice[r].poseta == _poseta;
+            if (vidljiva(r, oko)) {
+                if (!posecena) {
+                    _vidljive.push_back(r);
+                    _stek.push_back(r);
+                }
+            } else {
+                _horizont.push_back({_stranice[s].v[i], _stranice[s].v[(i + 1) % 3], r});
+            }
+        }
+    }
+
+    /* Spoljne tacke vidljivih stranica postaju kandidati, a stranice se brisu */
+    size_t m = 0;
+    for (auto s : _vidljive) {
+        for (auto t : _stranice[s].spoljne) {
+            _kx[m] = _tacke.x[t];
+            _ky[m] = _tacke.y[t];
+            _kz[m] = _tacke.z[t];
+            _ki[m] = t;
+            m++;
+        }
+        ukloni(s);
+    }
+
+    /* Nova stranica nad svakom ivicom horizonta; susedne nove stranice dele
+     * ivicu od oka do zajednickog temena, pa se povezuju po temenu */
+    _nove.clear();
+    for (const auto &ivica : _horizont) {
+        const auto s = novaStranica(ivica.a, ivica.b, oko);
+        _stranice[s].sused[0] = ivica.spolja;
+        auto &spolja = _stranice[ivica.spolja];
+        for (unsigned j = 0; j < 3; j++)
+            if (spolja.v[j] == ivica.b && spolja.v[(j + 1) % 3] == ivica.a)
+                spolja.sused[j] = s;
+        _poTemenu[ivica.a] = s;
+        _nove.push_back(s);
+    }
+    for (auto s : _nove) {
+        const auto sledeca = _poTemenu[_stranice[s].v[1]];
+        _stranice[s].sused[1] = sledeca;
+        _stranice[sledeca].sused[2] = s;
+    }
+
+    rasporedi(m, _nove);
+    return true;
+}
+
+void Quickhull3D::trouglovi(std::vector<uint32_t> &trouglovi) const
+{
+    trouglovi.clear();
+    for (const auto &stranica : _stranice)
+        if (stranica.ziva)
+            trouglovi.insert(trouglovi.end(), stranica.v, stranica.v + 3);
+}
+
+}
+
+bool geometrija::quickhull3D(PogledTacaka3D<double> tacke, std::vector<uint32_t> &trouglovi,
+                             Posmatrac *posmatrac)
+{
+    trouglovi.clear();
+
+    /* Izdvajanje trouglova posle svakog temena je O(h), pa se radi samo za crtanje */
+    const bool crta = posmatrac && posmatrac->crta();
+
+    Posmatrac_faza(posmatrac, "tetraedar")
+    Quickhull3D omotac(tacke);
+    if (!omotac.pocetniTetraedar())
+        return true;
+    if (crta)
+        omotac.trouglovi(trouglovi);
+    Posmatrac_korak(posmatrac)
+
+    Posmatrac_faza(posmatrac, "dodavanje-temena")
+    while (omotac.imaSpoljnih()) {
+        if (!omotac.dodajSledece())
+            continue;
+        if (crta)
+            omotac.trouglovi(trouglovi);
+        Posmatrac_korak(posmatrac)
+    }
+
+    omotac.trouglovi(trouglovi);
+    return true;
+}
@@ -0,0 +1,34 @@
+#ifndef GA_CORE_KONVEKSNIOMOTAC3D_H
+#define GA_CORE_KONVEKSNIOMOTAC3D_H
+
+#include <cstdint>
+#include <vector>
+
+#include "posmatrac.h"
+#include "tacke.h"
+
+namespace geometrija {
+
+///
+/// \brief quickhull3D - konveksni omotac u prostoru algoritmom Quickhull: od
+///     pocetnog tetraedra, svaka stranica cuva tacke izvan nje, a najdalja od njih
+///     se dodaje u omotac; stranice vidljive iz nje se brisu, horizont se spaja sa
+///     njom novim stranicama, a tacke obrisanih stranica rasporedjuju na nove (ili
+///     odbacuju ako su unutar omotaca). Znak zapremine se racuna paketnim
+///     predikatom (znakoviOrijentacije3D) nad zasebnim nizovima koordinata
+///     kandidata, pa je tacan, a udaljenost od ravni prolazom bez grananja koji
+///     se vektorizuje. O(n log n) u proseku.
+///     Faze su "tetraedar" i "dodavanje-temena", sa korakom posle svakog temena;
+///     ako posmatrac crta, trouglovi tekuceg omotaca su u izlazu pre svakog koraka.
+/// \param trouglovi - izlaz: po tri indeksa temena za svaku stranicu, poredjana
+///     tako da su sve tacke sa nenegativne strane, tj. orijentacija3D(a, b, c, p) >= 0.
+///     Stranice u istoj ravni se ne spajaju. Izlaz je prazan ako nema cetiri
+///     nekomplanarne tacke.
+/// \return false ako je posmatrac prekinuo izvrsavanje
+///
+bool quickhull3D(PogledTacaka3D<double> tacke, std::vector<uint32_t> &trouglovi,
+                 Posmatrac *posmatrac = nullptr);
+
+}
+
+#endif // GA_CORE_KONVEKSNIOMOTAC3D_H
@@ -0,0 +1,309 @@
+#include "paketnipredikati.h"
+#include "predikati.h"
+
+#include <algorithm>
+
+/* Vektorske verzije postoje samo za x86 uz GCC/Clang, zbog target atributa
+ * i __builtin_cpu_supports; ostali prevodioci koriste skalarnu verziju */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PAKETNI_X86 1
+#include <immintrin.h>
+#else
+#define PAKETNI_X86 0
+#endif
+
+namespace {
+
+/* Koliko se znakova racuna odjednom pri trazenju prve tacke */
+const size_t VELICINA_BLOKA = 256;
+
+struct Jezgro {
+    const char *ime;
+    void (*znakovi2D)(double ax, double ay, double bx, double by,
+                      const double *x, const double *y, size_t n, int8_t *znakovi);
+    void (*znakovi3D)(const double *a, const double *b, const double *c,
+                      const double *x, const double *y, const double *z, size_t n, int8_t *znakovi);
+};
+
+inline int8_t znak(double vrednost)
+{
+    return vrednost > 0 ? 1 : (vrednost < 0 ? -1 : 0);
+}
+
+inline unsigned bitZnaka(int8_t z)
+{
+    return z < 0 ? geometrija::NEGATIVNA : (z > 0 ? geometrija::POZITIVNA : geometrija::NULA);
+}
+
+inline int8_t znak2D(double ax, double ay, double bx, double by, double px, double py)
+{
+    return znak(geometrija::orijentacija(ax, ay, bx, by, px, py));
+}
+
+inline int8_t znak3D(const double *a, const double *b, const double *c, double px, double py, double pz)
+{
+    return znak(geometrija::orijentacija3D(a[0], a[1], a[2], b[0], b[1], b[2],
+                                                c[0], c[1], c[2], px, py, pz));
+}
+
+void znakovi2DSkalarno(double ax, double ay, double bx, double by,
+                       const double *x, const double *y, size_t n, int8_t *znakovi)
+{
+    for (size_t i = 0; i < n; i++)
+        znakovi[i] = znak2D(ax, ay, bx, by, x[i], y[i]);
+}
+
+void znakovi3DSkalarno(const double *a, const double *b, const double *c,
+                       const double *x, const double *y, const double *z, size_t n, int8_t *znakovi)
+{
+    for (size_t i = 0; i < n; i++)
+        znakovi[i] = znak3D(a, b, c, x[i], y[i], z[i]);
+}
+
+#if PAKETNI_X86
+
+/* Upis znakova jednog vektora: bitovi maski su trake sa sigurno pozitivnom,
+ * odnosno negativnom determinantom; ostale trake se racunaju robusno */
+template <typename Robusno>
+inline void upisiZnakove(unsigned pozitivne, unsigned negativne, size_t sirina,
+                         size_t i, int8_t *znakovi, Robusno robusno)
+{
+    for (size_t j = 0; j < sirina; j++) {
+        if (pozitivne & (1u << j))
+            znakovi[i + j] = 1;
+        else if (negativne & (1u << j))
+            znakovi[i + j] = -1;
+        else
+            znakovi[i + j] = robusno(i + j);
+    }
+}
+
+__attribute__((target("sse2")))
+void znakovi2DSse2(double ax, double ay, double bx, double by,
+                   const double *x, const double *y, size_t n, int8_t *znakovi)
+{
+    const __m128d vax = _mm_set1_pd(ax), vay = _mm_set1_pd(ay);
+    const __m128d vbx = _mm_set1_pd(bx), vby = _mm_set1_pd(by);
+    const __m128d bezZnaka = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+    const __m128d faktor = _mm_set1_pd(geometrija::GRANICA_ORIJENTACIJE);
+    const auto robusno = [&](size_t k) { return znak2D(ax, ay, bx, by, x[k], y[k]); };
+
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        const __m128d px = _mm_loadu_pd(x + i), py = _mm_loadu_pd(y + i);
+
+        /* Isti izraz kao u geometrija::orijentacija, sa P kao trecom tackom */
+        const __m128d levo = _mm_mul_pd(_mm_sub_pd(vax, px), _mm_sub_pd(vby, py));
+        const __m128d desno = _mm_mul_pd(_mm_sub_pd(vay, py), _mm_sub_pd(vbx, px));
+        const __m128d det = _mm_sub_pd(levo, desno);
+        const __m128d granica = _mm_mul_pd(faktor, _mm_add_pd(_mm_and_pd(levo, bezZnaka),
+                                                              _mm_and_pd(desno, bezZnaka)));
+
+        const unsigned pozitivne = _mm_movemask_pd(_mm_cmpgt_pd(det, granica));
+        const unsigned negativne = _mm_movemask_pd(_mm_cmplt_pd(det, _mm_sub_pd(_mm_setzero_pd(), granica)));
+        upisiZnakove(pozitivne, negativne, 2, i, znakovi, robusno);
+    }
+    for (; i < n; i++)
+        znakovi[i] = robusno(i);
+}
+
+__attribute__((target("avx")))
+void znakovi2DAvx(double ax, double ay, double bx, double by,
+                  const double *x, const double *y, size_t n, int8_t *znakovi)
+{
+    const __m256d vax = _mm256_set1_pd(ax), vay = _mm256_set1_pd(ay);
+    const __m256d vbx = _mm256_set1_pd(bx), vby = _mm256_set1_pd(by);
+    const __m256d bezZnaka = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    const __m256d faktor = _mm256_set1_pd(geometrija::GRANICA_ORIJENTACIJE);
+    const auto robusno = [&](size_t k) { return znak2D(ax, ay, bx, by, x[k], y[k]); };
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256d px = _mm256_loadu_pd(x + i), py = _mm256_loadu_pd(y + i);
+
+        const __m256d levo = _mm256_mul_pd(_mm256_sub_pd(vax, px), _mm256_sub_pd(vby, py));
+        const __m256d desno = _mm256_mul_pd(_mm256_sub_pd(vay, py), _mm256_sub_pd(vbx, px));
+        const __m256d det = _mm256_sub_pd(levo, desno);
+        const __m256d granica = _mm256_mul_pd(faktor, _mm256_add_pd(_mm256_and_pd(levo, bezZnaka),
+                                                                    _mm256_and_pd(desno, bezZnaka)));
+
+        const unsigned pozitivne = _mm256_movemask_pd(_mm256_cmp_pd(det, granica, _CMP_GT_OQ));
+        const unsigned negativne = _mm256_movemask_pd(
+                    _mm256_cmp_pd(det, _mm256_sub_pd(_mm256_setzero_pd(), granica), _CMP_LT_OQ));
+        upisiZnakove(pozitivne, negativne, 4, i, znakovi, robusno);
+    }
+    for (; i < n; i++)
+        znakovi[i] = robusno(i);
+}
+
+__attribute__((target("sse2")))
+void znakovi3DSse2(const double *a, const double *b, const double *c,
+                   const double *x, const double *y, const double *z, size_t n, int8_t *znakovi)
+{
+    const __m128d bezZnaka = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+    const __m128d faktor = _mm_set1_pd(geometrija::GRANICA_ORIJENTACIJE_3D);
+    const auto robusno = [&](size_t k) { return znak3D(a, b, c, x[k], y[k], z[k]); };
+
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        const __m128d px = _mm_loadu_pd(x + i), py = _mm_loadu_pd(y + i), pz = _mm_loadu_pd(z + i);
+
+        /* Isti izraz kao u geometrija::orijentacija3D, sa P kao cetvrtom tackom */
+        const __m128d adx = _mm_sub_pd(_mm_set1_pd(a[0]), px);
+        const __m128d ady = _mm_sub_pd(_mm_set1_pd(a[1]), py);
+        const __m128d adz = _mm_sub_pd(_mm_set1_pd(a[2]), pz);
+        const __m128d bdx = _mm_sub_pd(_mm_set1_pd(b[0]), px);
+        const __m128d bdy = _mm_sub_pd(_mm_set1_pd(b[1]), py);
+        const __m128d bdz = _mm_sub_pd(_mm_set1_pd(b[2]), pz);
+        const __m128d cdx = _mm_sub_pd(_mm_set1_pd(c[0]), px);
+        const __m128d cdy = _mm_sub_pd(_mm_set1_pd(c[1]), py);
+        const __m128d cdz = _mm_sub_pd(_mm_set1_pd(c[2]), pz);
+
+        const __m128d bdxcdy = _mm_mul_pd(bdx, cdy), cdxbdy = _mm_mul_pd(cdx, bdy);
+        const __m128d cdxady = _mm_mul_pd(cdx, ady), adxcdy = _mm_mul_pd(adx, cdy);
+        const __m128d adxbdy = _mm_mul_pd(adx, bdy), bdxady = _mm_mul_pd(bdx, ady);
+
+        const __m128d det = _mm_add_pd(_mm_add_pd(_mm_mul_pd(adz, _mm_sub_pd(bdxcdy, cdxbdy)),
+                                                  _mm_mul_pd(bdz, _mm_sub_pd(cdxady, adxcdy))),
+                                       _mm_mul_pd(cdz, _mm_sub_pd(adxbdy, bdxady)));
+        const __m128d permanent = _mm_add_pd(
+                    _mm_add_pd(_mm_mul_pd(_mm_add_pd(_mm_and_pd(bdxcdy, bezZnaka), _mm_and_pd(cdxbdy, bezZnaka)),
+                                          _mm_and_pd(adz, bezZnaka)),
+                               _mm_mul_pd(_mm_add_pd(_mm_and_pd(cdxady, bezZnaka), _mm_and_pd(adxcdy, bezZnaka)),
+                                          _mm_and_pd(bdz, bezZnaka))),
+                    _mm_mul_pd(_mm_add_pd(_mm_and_pd(adxbdy, bezZnaka), _mm_and_pd(bdxady, bezZnaka)),
+                               _mm_and_pd(cdz, bezZnaka)));
+        const __m128d granica = _mm_mul_pd(faktor, permanent);
+
+        const unsigned pozitivne = _mm_movemask_pd(_mm_cmpgt_pd(det, granica));
+        const unsigned negativne = _mm_movemask_pd(_mm_cmplt_pd(det, _mm_sub_pd(_mm_setzero_pd(), granica)));
+        upisiZnakove(pozitivne, negativne, 2, i, znakovi, robusno);
+    }
+    for (; i < n; i++)
+        znakovi[i] = robusno(i);
+}
+
+__attribute__((target("avx")))
+void znakovi3DAvx(const double *a, const double *b, const double *c,
+                  const double *x, const double *y, const double *z, size_t n, int8_t *znakovi)
+{
+    const __m256d bezZnaka = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    const __m256d faktor = _mm256_set1_pd(geometrija::GRANICA_ORIJENTACIJE_3D);
+    const auto robusno = [&](size_t k) { return znak3D(a, b, c, x[k], y[k], z[k]); };
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256d px = _mm256_loadu_pd(x + i), py = _mm256_loadu_pd(y + i), pz = _mm256_loadu_pd(z + i);
+
+        const __m256d adx = _mm256_sub_pd(_mm256_set1_pd(a[0]), px);
+        const __m256d ady = _mm256_sub_pd(_mm256_set1_pd(a[1]), py);
+        const __m256d adz = _mm256_sub_pd(_mm256_set1_pd(a[2]), pz);
+        const __m256d bdx = _mm256_sub_pd(_mm256_set1_pd(b[0]), px);
+        const __m256d bdy = _mm256_sub_pd(_mm256_set1_pd(b[1]), py);
+        const __m256d bdz = _mm256_sub_pd(_mm256_set1_pd(b[2]), pz);
+        const __m256d cdx = _mm256_sub_pd(_mm256_set1_pd(c[0]), px);
+        const __m256d cdy = _mm256_sub_pd(_mm256_set1_pd(c[1]), py);
+        const __m256d cdz = _mm256_sub_pd(_mm256_set1_pd(c[2]), pz);
+
+        const __m256d bdxcdy = _mm256_mul_pd(bdx, cdy), cdxbdy = _mm256_mul_pd(cdx, bdy);
+        const __m256d cdxady = _mm256_mul_pd(cdx, ady), adxcdy = _mm256_mul_pd(adx, cdy);
+        const __m256d adxbdy = _mm256_mul_pd(adx, bdy), bdxady = _mm256_mul_pd(bdx, ady);
+
+        const __m256d det = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(adz, _mm256_sub_pd(bdxcdy, cdxbdy)),
+                                                        _mm256_mul_pd(bdz, _mm256_sub_pd(cdxady, adxcdy))),
+                                          _mm256_mul_pd(cdz, _mm256_sub_pd(adxbdy, bdxady)));
+        const __m256d permanent = _mm256_add_pd(
+                    _mm256_add_pd(_mm256_mul_pd(_mm256_add_pd(_mm256_and_pd(bdxcdy, bezZnaka),
+                                                              _mm256_and_pd(cdxbdy, bezZnaka)),
+                                                _mm256_and_pd(adz, bezZnaka)),
+                                  _mm256_mul_pd(_mm256_add_pd(_mm256_and_pd(cdxady, bezZnaka),
+                                                              _mm256_and_pd(adxcdy, bezZnaka)),
+                                                _mm256_and_pd(bdz, bezZnaka))),
+                    _mm256_mul_pd(_mm256_add_pd(_mm256_and_pd(adxbdy, bezZnaka), _mm256_and_pd(bdxady, bezZnaka)),
+                                  _mm256_and_pd(cdz, bezZnaka)));
+        const __m256d granica = _mm256_mul_pd(faktor, permanent);
+
+        const unsigned pozitivne = _mm256_movemask_pd(_mm256_cmp_pd(det, granica, _CMP_GT_OQ));
+        const unsigned negativne = _mm256_movemask_pd(
+                    _mm256_cmp_pd(det, _mm256_sub_pd(_mm256_setzero_pd(), granica), _CMP_LT_OQ));
+        upisiZnakove(pozitivne, negativne, 4, i, znakovi, robusno);
+    }
+    for (; i < n; i++)
+        znakovi[i] = robusno(i);
+}
+
+#endif
+
+Jezgro izaberiJezgro()
+{
+#if PAKETNI_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx"))
+        return {"avx", znakovi2DAvx, znakovi3DAvx};
+    if (__builtin_cpu_supports("sse2"))
+        return {"sse2", znakovi2DSse2, znakovi3DSse2};
+#endif
+    return {"skalarno", znakovi2DSkalarno, znakovi3DSkalarno};
+}
+
+/* Bira se jednom, pri prvom pozivu */
+const Jezgro &jezgro()
+{
+    static const Jezgro izabrano = izaberiJezgro();
+    return izabrano;
+}
+
+}
+
+void geometrija::znakoviOrijentacije(double ax, double ay, double bx, double by,
+                                          const double *x, const double *y, size_t n, int8_t *znakovi)
+{
+    jezgro().znakovi2D(ax, ay, bx, by, x, y, n, znakovi);
+}
+
+size_t geometrija::prvaOrijentacija(double ax, double ay, double bx, double by,
+                                         const double *x, const double *y, size_t n, unsigned znakovi)
+{
+    const auto &j = jezgro();
+    int8_t blok[VELICINA_BLOKA];
+
+    for (size_t pocetak = 0; pocetak < n; pocetak += VELICINA_BLOKA) {
+        const auto m = std::min(VELICINA_BLOKA, n - pocetak);
+        j.znakovi2D(ax, ay, bx, by, x + pocetak, y + pocetak, m, blok);
+        for (size_t i = 0; i < m; i++) {
+            if (bitZnaka(blok[i]) & znakovi)
+                return pocetak + i;
+        }
+    }
+    return n;
+}
+
+void geometrija::znakoviOrijentacije3D(const double a[3], const double b[3], const double c[3],
+                                            const double *x, const double *y, const double *z, size_t n,
+                                            int8_t *znakovi)
+{
+    jezgro().znakovi3D(a, b, c, x, y, z, n, znakovi);
+}
+
+size_t geometrija::prvaOrijentacija3D(const double a[3], const double b[3], const double c[3],
+                                           const double *x, const double *y, const double *z, size_t n,
+                                           unsigned znakovi)
+{
+    const auto &j = jezgro();
+    int8_t blok[VELICINA_BLOKA];
+
+    for (size_t pocetak = 0; pocetak < n; pocetak += VELICINA_BLOKA) {
+        const auto m = std::min(VELICINA_BLOKA, n - pocetak);
+        j.znakovi3D(a, b, c, x + pocetak, y + pocetak, z + pocetak, m, blok);
+        for (size_t i = 0; i < m; i++) {
+            if (bitZnaka(blok[i]) & znakovi)
+                return pocetak + i;
+        }
+    }
+    return n;
+}
+
+const char *geometrija::skupInstrukcija()
+{
+    return jezgro().ime;
+}
@@ -0,0 +1,44 @@
+#ifndef GA_CORE_PAKETNIPREDIKATI_H
+#define GA_CORE_PAKETNIPREDIKATI_H
+
+#include <cstddef>
+#include <cstdint>
+
+/* Paketni predikati: orijentacija jedne usmerene duzi (ili stranice) u odnosu na
+ * niz tacaka zadat po koordinatama (x[i], y[i], z[i]). Brza provera se racuna
+ * vektorski (AVX ili SSE2, bira se pri prvom pozivu prema procesoru), a tacke
+ * ciji znak ona ne moze da utvrdi se proveravaju pojedinacno robusnim predikatom
+ * (geometrija::orijentacija), pa je rezultat isti kao kod njega. */
+namespace geometrija {
+
+/* Skup znakova koji se trazi; kombinuju se sa | */
+enum ZnakOrijentacije : unsigned {
+    NEGATIVNA = 1,
+    NULA = 2,
+    POZITIVNA = 4
+};
+
+/* Znak (-1, 0, 1) orijentacije (A, B, P_i) za svaku od n tacaka */
+void znakoviOrijentacije(double ax, double ay, double bx, double by,
+                         const double *x, const double *y, size_t n, int8_t *znakovi);
+
+/* Prvi indeks i za koji je znak orijentacije (A, B, P_i) u skupu znakovi; n ako ga nema */
+size_t prvaOrijentacija(double ax, double ay, double bx, double by,
+                        const double *x, const double *y, size_t n, unsigned znakovi);
+
+/* Znak (-1, 0, 1) orijentacije (a, b, c, P_i), kao kod zapremine, za svaku od n tacaka */
+void znakoviOrijentacije3D(const double a[3], const double b[3], const double c[3],
+                           const double *x, const double *y, const double *z, size_t n,
+                           int8_t *znakovi);
+
+/* Prvi indeks i za koji je znak orijentacije (a, b, c, P_i) u skupu znakovi; n ako ga nema */
+size_t prvaOrijentacija3D(const double a[3], const double b[3], const double c[3],
+                          const double *x, const double *y, const double *z, size_t n,
+                          unsigned znakovi);
+
+/* Izabrani skup instrukcija: "avx", "sse2" ili "skalarno" */
+const char *skupInstrukcija();
+
+}
+
+#endif // GA_CORE_PAKETNIPREDIKATI_H
@@ -0,0 +1,53 @@
+#ifndef GA_CORE_POSMATRAC_H
+#define GA_CORE_POSMATRAC_H
+
+///
+/// \brief The Posmatrac class
+/// Veza algoritma iz ga_core sa okruzenjem koje ga animira ili meri (npr.
+/// AlgoritamBaza::PosmatracAlgoritma). Algoritam poziva korak() posle svake
+/// promene stanja koju vredi nacrtati, a faza() na pocetku svake faze. Bez
+/// posmatraca (nullptr) algoritam ne placa nista od ovoga.
+///
+namespace geometrija {
+
+class Posmatrac
+{
+public:
+    virtual ~Posmatrac() = default;
+
+    /* true ako izvrsavanje treba prekinuti */
+    virtual bool korak() = 0;
+
+    /* Pocetak imenovane faze (npr. "sortiranje"); prethodna faza se tu zavrsava */
+    virtual void faza(const char *ime) = 0;
+
+    /* Da li se medjustanja crtaju; algoritam tada sme da plati pripremu za crtanje */
+    virtual bool crta() const { return false; }
+
+    /* Udeo (0..1) koji tekuca faza prijavljuje uz trajanje, npr. udeo odbacenih tacaka */
+    virtual void udeo(double udeo) { (void)udeo; }
+};
+
+}
+
+/* Isto kao AlgoritamBaza_updateCanvasAndBlock(): ako posmatrac trazi prekid,
+ * funkcija algoritma se zavrsava vracanjem false */
+#define Posmatrac_korak(posmatrac) \
+    if ((posmatrac) && (posmatrac)->korak()) \
+    { \
+        return false; \
+    }
+
+#define Posmatrac_faza(posmatrac, ime) \
+    if (posmatrac) \
+    { \
+        (posmatrac)->faza(ime); \
+    }
+
+#define Posmatrac_udeo(posmatrac, vrednost) \
+    if (posmatrac) \
+    { \
+        (posmatrac)->udeo(vrednost); \
+    }
+
+#endif // GA_CORE_POSMATRAC_H
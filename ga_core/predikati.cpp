@@ -0,0 +1,220 @@
+#include "predikati.h"
+
+#include <cmath>
+#include <vector>
+
+using geometrija::GRANICA_ORIJENTACIJE;
+using geometrija::GRANICA_ORIJENTACIJE_3D;
+using geometrija::GRANICA_KRUGA;
+
+namespace {
+
+/* Tacna vrednost kao zbir double brojeva koji se ne preklapaju, od najmanjeg
+ * ka najvecem po apsolutnoj vrednosti; znak je znak poslednjeg clana. Koristi se
+ * samo kada brza provera ne uspe, pa alokacije ovde nisu bitne. */
+using Ekspanzija = std::vector<double>;
+
+/* a + b = x + y tacno, x = fl(a + b) */
+inline void zbirBezGreske(double a, double b, double &x, double &y)
+{
+    x = a + b;
+    const double bv = x - a;
+    const double av = x - bv;
+    y = (a - av) + (b - bv);
+}
+
+/* a * b = x + y tacno; fma racuna a * b - x sa jednim zaokruzivanjem, koje je ovde tacno */
+inline void proizvodBezGreske(double a, double b, double &x, double &y)
+{
+    x = a * b;
+    y = std::fma(a, b, -x);
+}
+
+/* e += b, uz izbacivanje nula */
+void dodaj(Ekspanzija &e, double b)
+{
+    double q = b;
+    size_t k = 0;
+    for (size_t i = 0; i < e.size(); i++) {
+        double h;
+        zbirBezGreske(q, e[i], q, h);
+        if (h != 0)
+            e[k++] = h;
+    }
+    e.resize(k);
+    if (q != 0)
+        e.push_back(q);
+}
+
+Ekspanzija razlika(double a, double b)
+{
+    Ekspanzija e;
+    dodaj(e, a);
+    dodaj(e, -b);
+    return e;
+}
+
+Ekspanzija zbir(Ekspanzija e, const Ekspanzija &f)
+{
+    for (auto clan : f)
+        dodaj(e, clan);
+    return e;
+}
+
+Ekspanzija suprotna(Ekspanzija e)
+{
+    for (auto &clan : e)
+        clan = -clan;
+    return e;
+}
+
+Ekspanzija proizvod(const Ekspanzija &e, const Ekspanzija &f)
+{
+    Ekspanzija r;
+    for (auto a : e) {
+        for (auto b : f) {
+            double x, y;
+            proizvodBezGreske(a, b, x, y);
+            dodaj(r, y);
+            dodaj(r, x);
+        }
+    }
+    return r;
+}
+
+/* ad - bc */
+Ekspanzija determinanta2(const Ekspanzija &a, const Ekspanzija &b,
+                         const Ekspanzija &c, const Ekspanzija &d)
+{
+    return zbir(proizvod(a, d), suprotna(proizvod(b, c)));
+}
+
+/* Priblizna vrednost sa tacnim znakom */
+double procena(const Ekspanzija &e)
+{
+    double s = 0;
+    for (auto clan : e)
+        s += clan;
+    return s;
+}
+
+double orijentacijaTacno(double ax, double ay, double bx, double by, double cx, double cy)
+{
+    return procena(determinanta2(razlika(ax, cx), razlika(ay, cy),
+                                 razlika(bx, cx), razlika(by, cy)));
+}
+
+double orijentacija3DTacno(double ax, double ay, double az, double bx, double by, double bz,
+                           double cx, double cy, double cz, double dx, double dy, double dz)
+{
+    const auto adx = razlika(ax, dx), ady = razlika(ay, dy), adz = razlika(az, dz);
+    const auto bdx = razlika(bx, dx), bdy = razlika(by, dy), bdz = razlika(bz, dz);
+    const auto cdx = razlika(cx, dx), cdy = razlika(cy, dy), cdz = razlika(cz, dz);
+
+    auto det = proizvod(adz, determinanta2(bdx, bdy, cdx, cdy));
+    det = zbir(det, proizvod(bdz, determinanta2(cdx, cdy, adx, ady)));
+    det = zbir(det, proizvod(cdz, determinanta2(adx, ady, bdx, bdy)));
+    return procena(det);
+}
+
+double uKruguTacno(double ax, double ay, double bx, double by,
+                   double cx, double cy, double dx, double dy)
+{
+    const auto adx = razlika(ax, dx), ady = razlika(ay, dy);
+    const auto bdx = razlika(bx, dx), bdy = razlika(by, dy);
+    const auto cdx = razlika(cx, dx), cdy = razlika(cy, dy);
+
+    const auto alift = zbir(proizvod(adx, adx), proizvod(ady, ady));
+    const auto blift = zbir(proizvod(bdx, bdx), proizvod(bdy, bdy));
+    const auto clift = zbir(proizvod(cdx, cdx), proizvod(cdy, cdy));
+
+    auto det = proizvod(alift, determinanta2(bdx, bdy, cdx, cdy));
+    det = zbir(det, proizvod(blift, determinanta2(cdx, cdy, adx, ady)));
+    det = zbir(det, proizvod(clift, determinanta2(adx, ady, bdx, bdy)));
+    return procena(det);
+}
+
+}
+
+double geometrija::orijentacija(double ax, double ay, double bx, double by, double cx, double cy)
+{
+    /* 2P(Trougla) = |ax ay 1|   |ax-cx ay-cy|
+     *               |bx by 1| = |bx-cx by-cy|
+     *               |cx cy 1|
+     */
+    const double levo = (ax - cx) * (by - cy);
+    const double desno = (ay - cy) * (bx - cx);
+    const double det = levo - desno;
+
+    /* Brza provera: greska zaokruzivanja ne moze da promeni znak */
+    const double granica = GRANICA_ORIJENTACIJE * (std::fabs(levo) + std::fabs(desno));
+    if (det > granica || -det > granica)
+        return det;
+
+    return orijentacijaTacno(ax, ay, bx, by, cx, cy);
+}
+
+double geometrija::orijentacija3D(double ax, double ay, double az, double bx, double by, double bz,
+                                       double cx, double cy, double cz, double dx, double dy, double dz)
+{
+    /* 6V(Tetraedar) = |ax ay az 1|   |ax-dx ay-dy az-dz|
+     *                 |bx by bz 1| = |bx-dx by-dy bz-dz|
+     *                 |cx cy cz 1|   |cx-dx cy-dy cz-dz|
+     *                 |dx dy dz 1|
+     * razvijeno po trecoj koloni
+     */
+    const double adx = ax - dx, ady = ay - dy, adz = az - dz;
+    const double bdx = bx - dx, bdy = by - dy, bdz = bz - dz;
+    const double cdx = cx - dx, cdy = cy - dy, cdz = cz - dz;
+
+    const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    const double cdxady = cdx * ady, adxcdy = adx * cdy;
+    const double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+    const double det = adz * (bdxcdy - cdxbdy)
+                     + bdz * (cdxady - adxcdy)
+                     + cdz * (adxbdy - bdxady);
+    const double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * std::fabs(adz)
+                           + (std::fabs(cdxady) + std::fabs(adxcdy)) * std::fabs(bdz)
+                           + (std::fabs(adxbdy) + std::fabs(bdxady)) * std::fabs(cdz);
+
+    const double granica = GRANICA_ORIJENTACIJE_3D * permanent;
+    if (det > granica || -det > granica)
+        return det;
+
+    return orijentacija3DTacno(ax, ay, az, bx, by, bz, cx, cy, cz, dx, dy, dz);
+}
+
+double geometrija::uKrugu(double ax, double ay, double bx, double by,
+                          double cx, double cy, double dx, double dy)
+{
+    /*        |ax ay ax^2+ay^2 1|
+     *  det = |bx by bx^2+by^2 1|
+     *        |cx cy cx^2+cy^2 1|
+     *        |dx dy dx^2+dy^2 1|
+     * racunato nad razlikama u odnosu na D
+     */
+    const double adx = ax - dx, ady = ay - dy;
+    const double bdx = bx - dx, bdy = by - dy;
+    const double cdx = cx - dx, cdy = cy - dy;
+
+    const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    const double alift = adx * adx + ady * ady;
+    const double cdxady = cdx * ady, adxcdy = adx * cdy;
+    const double blift = bdx * bdx + bdy * bdy;
+    const double adxbdy = adx * bdy, bdxady = bdx * ady;
+    const double clift = cdx * cdx + cdy * cdy;
+
+    const double det = alift * (bdxcdy - cdxbdy)
+                     + blift * (cdxady - adxcdy)
+                     + clift * (adxbdy - bdxady);
+    const double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * alift
+                           + (std::fabs(cdxady) + std::fabs(adxcdy)) * blift
+                           + (std::fabs(adxbdy) + std::fabs(bdxady)) * clift;
+
+    const double granica = GRANICA_KRUGA * permanent;
+    if (det > granica || -det > granica)
+        return det;
+
+    return uKruguTacno(ax, ay, bx, by, cx, cy, dx, dy);
+}
@@ -0,0 +1,64 @@
+#ifndef GA_CORE_PREDIKATI_H
+#define GA_CORE_PREDIKATI_H
+
+#include <cstdint>
+
+/* Geometrijski predikati nad golim koordinatama, bez Qt-a. */
+namespace geometrija {
+
+/* Celobrojni predikati su parametrizovani tipom koordinate T, a razlike i
+ * proizvodi se racunaju u dvostruko sirem tipu Siroki<T>. Rezultat je tacan
+ * za |x|, |y| < 2^30 kod int32_t (medjurezultati int64_t), odnosno < 2^62
+ * kod int64_t (medjurezultati __int128, samo GCC i Clang). */
+template <typename T> struct SirokiTip;
+template <> struct SirokiTip<int32_t> { using tip = int64_t; };
+#ifdef __SIZEOF_INT128__
+template <> struct SirokiTip<int64_t> { using tip = __int128; };
+#endif
+template <typename T> using Siroki = typename SirokiTip<T>::tip;
+
+/* (Dvostruka) povrsina trougla ABC; > 0 ako je C levo od AB */
+template <typename T>
+inline Siroki<T> povrsinaTrougla(T ax, T ay, T bx, T by, T cx, T cy)
+{
+    using S = Siroki<T>;
+    return (S(bx) - ax)*(S(cy) - ay) - (S(cx) - ax)*(S(by) - ay);
+}
+
+template <typename T>
+inline Siroki<T> distanceKvadrat(T ax, T ay, T bx, T by)
+{
+    using S = Siroki<T>;
+    return (S(ax) - bx)*(S(ax) - bx) + (S(ay) - by)*(S(ay) - by);
+}
+
+/* Robusni predikati: vracaju vrednost determinante ciji je znak uvek tacan.
+ * Determinanta se prvo racuna u pokretnom zarezu; samo ako je po apsolutnoj
+ * vrednosti manja od granice greske zaokruzivanja, znak se odredjuje tacnom
+ * aritmetikom (zbirovi i proizvodi bez greske, kao kod Shewchuka). */
+
+/* Polovina razmaka izmedju 1 i sledeceg double broja (2^-53) */
+constexpr double EPSILON_ZAOKRUZIVANJA = 1.0 / 9007199254740992.0;
+
+/* Granice relativne greske brze provere: znak determinante je siguran ako je
+ * |det| > granica * permanent (Shewchuk) */
+constexpr double GRANICA_ORIJENTACIJE = (3.0 + 16.0 * EPSILON_ZAOKRUZIVANJA) * EPSILON_ZAOKRUZIVANJA;
+constexpr double GRANICA_ORIJENTACIJE_3D = (7.0 + 56.0 * EPSILON_ZAOKRUZIVANJA) * EPSILON_ZAOKRUZIVANJA;
+constexpr double GRANICA_KRUGA = (10.0 + 96.0 * EPSILON_ZAOKRUZIVANJA) * EPSILON_ZAOKRUZIVANJA;
+
+/* Dvostruka povrsina trougla ABC; > 0 ako je ABC pozitivno orijentisan (C levo od AB),
+ * 0 ako su tacke kolinearne */
+double orijentacija(double ax, double ay, double bx, double by, double cx, double cy);
+
+/* Sestostruka zapremina tetraedra abcd sa tacnim znakom; 0 ako su tacke komplanarne */
+double orijentacija3D(double ax, double ay, double az, double bx, double by, double bz,
+                      double cx, double cy, double cz, double dx, double dy, double dz);
+
+/* > 0 ako je D unutar kruga kroz A, B i C, pri cemu je ABC pozitivno orijentisan;
+ * 0 ako su sve cetiri tacke na istom krugu */
+double uKrugu(double ax, double ay, double bx, double by,
+              double cx, double cy, double dx, double dy);
+
+}
+
+#endif // GA_CORE_PREDIKATI_H
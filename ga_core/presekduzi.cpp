@@ -0,0 +1,88 @@
+#include "presekduzi.h"
+#include "predikati.h"
+
+#include <tuple>
+
+namespace {
+
+/* Koliko se okvira proverava odjednom */
+const size_t VELICINA_BLOKA = 256;
+
+inline bool istaStrana(double o1, double o2)
+{
+    return (o1 > 0 && o2 > 0) || (o1 < 0 && o2 < 0);
+}
+
+}
+
+bool geometrija::seku(const Duz &a, const Duz &b)
+{
+    if (!preklapajuSeOkviri(a, b))
+        return false;
+
+    const double o1 = orijentacija(a.x1, a.y1, a.x2, a.y2, b.x1, b.y1);
+    const double o2 = orijentacija(a.x1, a.y1, a.x2, a.y2, b.x2, b.y2);
+    if (istaStrana(o1, o2))
+        return false;
+
+    /* Oba kraja duzi b na pravoj kroz a: kolinearne (ili degenerisane) duzi */
+    if (o1 == 0 && o2 == 0)
+        return false;
+
+    const double o3 = orijentacija(b.x1, b.y1, b.x2, b.y2, a.x1, a.y1);
+    const double o4 = orijentacija(b.x1, b.y1, b.x2, b.y2, a.x2, a.y2);
+    return !istaStrana(o3, o4);
+}
+
+bool geometrija::tackaPreseka(const Duz &a, const Duz &b, double &x, double &y)
+{
+    /* Racuna se uvek od "manje" duzi, da bi (a, b) i (b, a) dali istu tacku */
+    const bool zameni = std::tie(b.x1, b.y1, b.x2, b.y2) < std::tie(a.x1, a.y1, a.x2, a.y2);
+    const Duz &p = zameni ? b : a;
+    const Duz &q = zameni ? a : b;
+
+    const double pdx = p.x2 - p.x1, pdy = p.y2 - p.y1;
+    const double qdx = q.x2 - q.x1, qdy = q.y2 - q.y1;
+    const double imenilac = pdx * qdy - pdy * qdx;
+    if (imenilac == 0)
+        return false;
+
+    const double t = ((q.x1 - p.x1) * qdy - (q.y1 - p.y1) * qdx) / imenilac;
+    x = p.x1 + t * pdx;
+    y = p.y1 + t * pdy;
+    return true;
+}
+
+bool geometrija::presek(const Duz &a, const Duz &b, double &x, double &y)
+{
+    return seku(a, b) && tackaPreseka(a, b, x, y);
+}
+
+void geometrija::duziKojeSeku(const Duz &d, const NizDuzi &duzi, size_t od, std::vector<uint32_t> &indeksi)
+{
+    indeksi.clear();
+
+    const double xMin = std::min(d.x1, d.x2), xMax = std::max(d.x1, d.x2);
+    const double yMin = std::min(d.y1, d.y2), yMax = std::max(d.y1, d.y2);
+    const double *const x1 = duzi.x1.data();
+    const double *const y1 = duzi.y1.data();
+    const double *const x2 = duzi.x2.data();
+    const double *const y2 = duzi.y2.data();
+
+    uint8_t okvir[VELICINA_BLOKA];
+    for (size_t pocetak = od; pocetak < duzi.size(); pocetak += VELICINA_BLOKA) {
+        const auto m = std::min(VELICINA_BLOKA, duzi.size() - pocetak);
+
+        /* Bez grananja, da bi se petlja vektorizovala */
+        for (size_t i = 0; i < m; i++) {
+            const size_t k = pocetak + i;
+            okvir[i] = (std::max(x1[k], x2[k]) >= xMin) & (std::min(x1[k], x2[k]) <= xMax) &
+                       (std::max(y1[k], y2[k]) >= yMin) & (std::min(y1[k], y2[k]) <= yMax);
+        }
+
+        for (size_t i = 0; i < m; i++) {
+            if (okvir[i] && seku(d, duzi[pocetak + i]))
+                indeksi.push_back(static_cast<uint32_t>(pocetak + i));
+        }
+    }
+}
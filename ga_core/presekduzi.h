@@ -0,0 +1,92 @@
+#ifndef GA_CORE_PRESEKDUZI_H
+#define GA_CORE_PRESEKDUZI_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geometrija {
+
+struct Duz {
+    double x1, y1, x2, y2;
+};
+
+/* Duzi kao zasebni nizovi koordinata krajeva, za paketnu proveru preseka */
+struct NizDuzi {
+    std::vector<double> x1, y1, x2, y2;
+
+    size_t size() const { return x1.size(); }
+
+    void reserve(size_t n)
+    {
+        x1.reserve(n);
+        y1.reserve(n);
+        x2.reserve(n);
+        y2.reserve(n);
+    }
+
+    void push_back(const Duz &d)
+    {
+        x1.push_back(d.x1);
+        y1.push_back(d.y1);
+        x2.push_back(d.x2);
+        y2.push_back(d.y2);
+    }
+
+    Duz operator[](size_t i) const
+    {
+        return {x1[i], y1[i], x2[i], y2[i]};
+    }
+};
+
+/* Da li se pravougaonici opisani oko duzi preklapaju (jeftino odbacivanje) */
+inline bool preklapajuSeOkviri(const Duz &a, const Duz &b)
+{
+    return std::max(a.x1, a.x2) >= std::min(b.x1, b.x2) &&
+           std::max(b.x1, b.x2) >= std::min(a.x1, a.x2) &&
+           std::max(a.y1, a.y2) >= std::min(b.y1, b.y2) &&
+           std::max(b.y1, b.y2) >= std::min(a.y1, a.y2);
+}
+
+///
+/// \brief seku - da li duzi imaju zajednicku tacku, samo iz znakova robusnih
+///     orijentacija, bez racunanja same tacke. Dodir (kraj jedne na drugoj) se
+///     racuna kao presek; kolinearne duzi su paralelne i, kao kod QLineF, nemaju presek.
+///
+bool seku(const Duz &a, const Duz &b);
+
+///
+/// \brief tackaPreseka - presek pravih kroz duzi, nezavisno od redosleda
+///     argumenata (isti par uvek daje istu tacku)
+/// \return false ako su prave paralelne
+///
+bool tackaPreseka(const Duz &a, const Duz &b, double &x, double &y);
+
+/* seku(), pa tek onda tackaPreseka() */
+bool presek(const Duz &a, const Duz &b, double &x, double &y);
+
+///
+/// \brief xNaVisini - x koordinata preseka prave kroz duz sa horizontalom na
+///     visini y (poredak duzi u statusu brisuce prave); za horizontalnu duz
+///     levi kraj
+///
+inline double xNaVisini(const Duz &d, double y)
+{
+    if (d.y1 == d.y2)
+        return std::min(d.x1, d.x2);
+    return d.x1 + (y - d.y1) * (d.x2 - d.x1) / (d.y2 - d.y1);
+}
+
+///
+/// \brief duziKojeSeku - paketna provera jedne duzi protiv duzi [od, duzi.size()):
+///     okviri se prvo proveravaju u jednom prolazu kroz nizove (koji prevodilac
+///     vektorizuje), a orijentacije samo za preostale kandidate
+/// \param indeksi - izlaz: indeksi duzi koje seku d; prethodni sadrzaj se brise,
+///     a kapacitet zadrzava, pa ponovljeni pozivi ne alociraju
+///
+void duziKojeSeku(const Duz &d, const NizDuzi &duzi, size_t od, std::vector<uint32_t> &indeksi);
+
+}
+
+#endif // GA_CORE_PRESEKDUZI_H
@@ -0,0 +1,202 @@
+#include "spoljniomotac2d.h"
+#include "dinamickiomotac2d.h"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPIRANJE_DOSTUPNO 1
+#else
+#define MAPIRANJE_DOSTUPNO 0
+#endif
+
+namespace {
+
+/* Datoteka iz koje se redom uzimaju delovi. Mapira se samo prozor tekuceg dela,
+ * koji se oslobadja pre sledeceg, pa ni adresni prostor ni RSS ne rastu sa
+ * velicinom datoteke; bez mmap-a se deo cita u bafer. */
+class DeloviDatoteke
+{
+public:
+    explicit DeloviDatoteke(const std::string &imeDatoteke);
+    ~DeloviDatoteke();
+
+    DeloviDatoteke(const DeloviDatoteke &) = delete;
+    DeloviDatoteke& operator=(const DeloviDatoteke &) = delete;
+
+    bool otvorena() const { return _otvorena; }
+    uint64_t velicina() const { return _velicina; }
+
+    /* Bajtovi [pomeraj, pomeraj + duzina), vazeci do sledeceg poziva; nullptr uz gresku */
+    const char *deo(uint64_t pomeraj, size_t duzina);
+
+private:
+    void oslobodi();
+
+    bool _otvorena = false;
+    uint64_t _velicina = 0;
+#if MAPIRANJE_DOSTUPNO
+    int _fd = -1;
+    void *_prozor = nullptr;
+    size_t _duzinaProzora = 0;
+#else
+    std::ifstream _ulaz;
+    std::vector<char> _bafer;
+#endif
+};
+
+#if MAPIRANJE_DOSTUPNO
+DeloviDatoteke::DeloviDatoteke(const std::string &imeDatoteke)
+{
+    _fd = open(imeDatoteke.c_str(), O_RDONLY);
+    struct stat podaci;
+    if (_fd < 0 || fstat(_fd, &podaci) != 0)
+        return;
+    _velicina = static_cast<uint64_t>(podaci.st_size);
+    _otvorena = true;
+}
+
+DeloviDatoteke::~DeloviDatoteke()
+{
+    oslobodi();
+    if (_fd >= 0)
+        close(_fd);
+}
+
+const char *DeloviDatoteke::deo(uint64_t pomeraj, size_t duzina)
+{
+    oslobodi();
+
+    /* Pocetak prozora mora biti poravnat na stranicu */
+    const auto stranica = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const auto pocetak = pomeraj - pomeraj % stranica;
+    const auto pomak = static_cast<size_t>(pomeraj - pocetak);
+    _duzinaProzora = pomak + duzina;
+    _prozor = mmap(nullptr, _duzinaProzora, PROT_READ, MAP_PRIVATE, _fd, static_cast<off_t>(pocetak));
+    if (_prozor == MAP_FAILED) {
+        _prozor = nullptr;
+        return nullptr;
+    }
+    madvise(_prozor, _duzinaProzora, MADV_SEQUENTIAL);
+    return static_cast<const char *>(_prozor) + pomak;
+}
+
+void DeloviDatoteke::oslobodi()
+{
+    if (_prozor)
+        munmap(_prozor, _duzinaProzora);
+    _prozor = nullptr;
+}
+#else
+DeloviDatoteke::DeloviDatoteke(const std::string &imeDatoteke)
+    : _ulaz(imeDatoteke, std::ios::binary | std::ios::ate)
+{
+    if (!_ulaz)
+        return;
+    _velicina = static_cast<uint64_t>(_ulaz.tellg());
+    _otvorena = true;
+}
+
+DeloviDatoteke::~DeloviDatoteke()
+{}
+
+const char *DeloviDatoteke::deo(uint64_t pomeraj, size_t duzina)
+{
+    _bafer.resize(duzina);
+    _ulaz.seekg(static_cast<std::streamoff>(pomeraj));
+    if (!_ulaz.read(_bafer.data(), static_cast<std::streamsize>(duzina)))
+        return nullptr;
+    return _bafer.data();
+}
+
+void DeloviDatoteke::oslobodi()
+{}
+#endif
+
+}
+
+template <typename T>
+bool geometrija::omotacDatoteke(const std::string &imeDatoteke, Tacke2D<T> &temena,
+                                const ParametriOmotaca &parametri, size_t tacakaPoDelu,
+                                Posmatrac *posmatrac)
+{
+    temena.clear();
+
+    DeloviDatoteke datoteka(imeDatoteke);
+    const uint64_t velicinaTacke = 2*sizeof(T);
+    if (!datoteka.otvorena() || datoteka.velicina() % velicinaTacke != 0)
+        return false;
+    const uint64_t n = datoteka.velicina() / velicinaTacke;
+    tacakaPoDelu = std::max<size_t>(tacakaPoDelu, 1);
+
+    /* Deo se prepisuje u zasebne nizove koordinata, koje ocekuje konveksniOmotac */
+    Tacke2D<T> deo;
+    deo.reserve(static_cast<size_t>(std::min<uint64_t>(tacakaPoDelu, n)));
+    std::vector<uint32_t> omotacDela;
+    DinamickiOmotac<T> omotac;
+
+    for (uint64_t od = 0; od < n; od += tacakaPoDelu) {
+        const auto m = static_cast<size_t>(std::min<uint64_t>(tacakaPoDelu, n - od));
+
+        Posmatrac_faza(posmatrac, "citanje")
+        const auto *bajtovi = datoteka.deo(od * velicinaTacke, m * velicinaTacke);
+        if (!bajtovi)
+            return false;
+        const T *const koordinate = reinterpret_cast<const T *>(bajtovi);
+        deo.clear();
+        for (size_t i = 0; i < m; i++)
+            deo.push_back(koordinate[2*i], koordinate[2*i + 1]);
+
+        Posmatrac_faza(posmatrac, "omotac-dela")
+        if (!konveksniOmotac<T>(deo, omotacDela, parametri, posmatrac))
+            return false;
+
+        /* Temena dela su malo u odnosu na tekuci omotac, pa se umecu jedno po
+         * jedno; indeksi se ne koriste */
+        Posmatrac_faza(posmatrac, "spajanje")
+        for (size_t i = 0; i + 1 < omotacDela.size(); i++)
+            omotac.dodaj(deo.x[omotacDela[i]], deo.y[omotacDela[i]], 0);
+        Posmatrac_korak(posmatrac)
+    }
+
+    omotac.temena(temena);
+    return true;
+}
+
+template <typename T>
+bool geometrija::upisiTacke(const std::string &imeDatoteke, PogledTacaka2D<T> tacke, bool nastavak)
+{
+    std::ofstream izlaz(imeDatoteke, std::ios::binary | (nastavak ? std::ios::app : std::ios::trunc));
+    if (!izlaz)
+        return false;
+
+    /* Parovi (x, y) se upisuju u komadima ogranicene velicine */
+    const size_t KOMAD = 4096;
+    std::vector<T> parovi;
+    parovi.reserve(2*KOMAD);
+    for (size_t od = 0; od < tacke.size(); od += KOMAD) {
+        const auto m = std::min(KOMAD, tacke.size() - od);
+        parovi.clear();
+        for (size_t i = od; i < od + m; i++) {
+            parovi.push_back(tacke.x[i]);
+            parovi.push_back(tacke.y[i]);
+        }
+        izlaz.write(reinterpret_cast<const char *>(parovi.data()),
+                    static_cast<std::streamsize>(parovi.size() * sizeof(T)));
+    }
+    return static_cast<bool>(izlaz);
+}
+
+template bool geometrija::omotacDatoteke<int32_t>(const std::string &, Tacke2D<int32_t> &,
+                                                  const ParametriOmotaca &, size_t, Posmatrac *);
+template bool geometrija::upisiTacke<int32_t>(const std::string &, PogledTacaka2D<int32_t>, bool);
+#ifdef __SIZEOF_INT128__
+template bool geometrija::omotacDatoteke<int64_t>(const std::string &, Tacke2D<int64_t> &,
+                                                  const ParametriOmotaca &, size_t, Posmatrac *);
+template bool geometrija::upisiTacke<int64_t>(const std::string &, PogledTacaka2D<int64_t>, bool);
+#endif
@@ -0,0 +1,45 @@
+#ifndef GA_CORE_SPOLJNIOMOTAC2D_H
+#define GA_CORE_SPOLJNIOMOTAC2D_H
+
+#include <cstddef>
+#include <string>
+
+#include "konveksniomotac2d.h"
+#include "posmatrac.h"
+#include "tacke.h"
+
+///
+/// Omotac tacaka iz datoteke vece od radne memorije. Binarna datoteka tacaka je
+/// niz parova (x, y) tipa T, redom bajtova racunara i bez zaglavlja, pa je
+/// broj tacaka velicina datoteke / (2 * sizeof(T)).
+///
+namespace geometrija {
+
+/* Podrazumevani deo: 2^20 tacaka, tj. 8 MB koordinata za int32_t */
+const size_t TACAKA_PO_DELU = size_t(1) << 20;
+
+///
+/// \brief omotacDatoteke - omotac binarne datoteke tacaka bez ucitavanja cele
+///     datoteke: datoteka se mapira deo po deo (mmap; bez njega se deo cita),
+///     omotac svakog dela se racuna sa konveksniOmotac i zadatim parametrima, a
+///     njegova temena se umecu u tekuci omotac (DinamickiOmotac). Memorija je
+///     ogranicena velicinom dela i omotaca, nezavisno od velicine datoteke.
+///     Faze su "citanje", "omotac-dela" i "spajanje", za svaki deo.
+/// \param temena - izlaz: koordinate temena u obliku kao kod DinamickiOmotac::temena
+///     (indeksi ne bi stali u uint32_t za velike datoteke)
+/// \return false ako datoteka ne moze da se procita, velicina joj nije umnozak
+///     velicine tacke, ili je posmatrac prekinuo izvrsavanje
+///
+template <typename T>
+bool omotacDatoteke(const std::string &imeDatoteke, Tacke2D<T> &temena,
+                    const ParametriOmotaca &parametri = ParametriOmotaca(),
+                    size_t tacakaPoDelu = TACAKA_PO_DELU, Posmatrac *posmatrac = nullptr);
+
+/* Upis tacaka u binarnu datoteku; uz nastavak se dopisuju na kraj, pa se velika
+ * datoteka moze napraviti deo po deo */
+template <typename T>
+bool upisiTacke(const std::string &imeDatoteke, PogledTacaka2D<T> tacke, bool nastavak = false);
+
+}
+
+#endif // GA_CORE_SPOLJNIOMOTAC2D_H
@@ -0,0 +1,107 @@
+#ifndef GA_CORE_TACKE_H
+#define GA_CORE_TACKE_H
+
+#include <cstddef>
+#include <vector>
+
+namespace geometrija {
+
+/* Tacke u ravni kao zasebni nizovi koordinata (struct-of-arrays), kako bi
+ * prolazi kroz sve tacke mogli da se vektorizuju */
+template <typename T>
+struct Tacke2D {
+    std::vector<T> x, y;
+
+    size_t size() const { return x.size(); }
+    bool empty() const { return x.empty(); }
+
+    void reserve(size_t n)
+    {
+        x.reserve(n);
+        y.reserve(n);
+    }
+
+    void clear()
+    {
+        x.clear();
+        y.clear();
+    }
+
+    void push_back(T tx, T ty)
+    {
+        x.push_back(tx);
+        y.push_back(ty);
+    }
+};
+
+/* Pogled na tacke ciji su nizovi koordinata u tudjem vlasnistvu (npr. Tacke2D
+ * ili mapirana datoteka); mora da nadzivi sve koji ga koriste */
+template <typename T>
+struct PogledTacaka2D {
+    const T *x;
+    const T *y;
+    size_t n;
+
+    PogledTacaka2D(const T *px, const T *py, size_t pn)
+        : x(px), y(py), n(pn)
+    {}
+
+    PogledTacaka2D(const Tacke2D<T> &tacke)
+        : x(tacke.x.data()), y(tacke.y.data()), n(tacke.size())
+    {}
+
+    size_t size() const { return n; }
+};
+
+/* Tacke u prostoru, isto kao Tacke2D */
+template <typename T>
+struct Tacke3D {
+    std::vector<T> x, y, z;
+
+    size_t size() const { return x.size(); }
+    bool empty() const { return x.empty(); }
+
+    void reserve(size_t n)
+    {
+        x.reserve(n);
+        y.reserve(n);
+        z.reserve(n);
+    }
+
+    void clear()
+    {
+        x.clear();
+        y.clear();
+        z.clear();
+    }
+
+    void push_back(T tx, T ty, T tz)
+    {
+        x.push_back(tx);
+        y.push_back(ty);
+        z.push_back(tz);
+    }
+};
+
+/* Pogled na tacke u prostoru, isto kao PogledTacaka2D */
+template <typename T>
+struct PogledTacaka3D {
+    const T *x;
+    const T *y;
+    const T *z;
+    size_t n;
+
+    PogledTacaka3D(const T *px, const T *py, const T *pz, size_t pn)
+        : x(px), y(py), z(pz), n(pn)
+    {}
+
+    PogledTacaka3D(const Tacke3D<T> &tacke)
+        : x(tacke.x.data()), y(tacke.y.data()), z(tacke.z.data()), n(tacke.size())
+    {}
+
+    size_t size() const { return n; }
+};
+
+}
+
+#endif // GA_CORE_TACKE_H
@@ -0,0 +1,273 @@
+#include "generatorulaza.h"
+#include "config.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const char *const imenaRaspodela[] = {
+    "uniformna_kvadrat",
+    "uniformna_krug",
+    "na_kruznici",
+    "gausovi_klasteri",
+    "celobrojna_mreza",
+    "mesavina_duzi",
+};
+
+const double PI = 3.14159265358979323846;
+
+/* Broj klastera za Gausovu raspodelu i relativna standardna devijacija */
+const int BROJ_KLASTERA = 6;
+const double SIRINA_KLASTERA = 0.05;
+
+/* Stranica oblasti bez kanvasa: po korenu iz n za raspodele po povrsini i po
+ * n^2 na kruznici (susedne tacke moraju biti dalje od greske zaokruzivanja
+ * u odnosu na luk izmedju njih) */
+const double STRANICA_PO_KORENU = 64;
+const double STRANICA_NA_KRUZNICI = 8;
+
+/* Udeo dugackih duzi u mesavini i relativna duzina kratkih */
+const double UDEO_DUGACKIH = 0.1;
+const double DUZINA_KRATKIH = 0.02;
+
+}
+
+const char *imeRaspodele(Raspodela raspodela)
+{
+    return imenaRaspodela[static_cast<int>(raspodela)];
+}
+
+bool raspodelaIzImena(const std::string &ime, Raspodela &raspodela)
+{
+    for (int i = 0; i < static_cast<int>(Raspodela::BROJ_RASPODELA); i++) {
+        if (ime == imenaRaspodela[i]) {
+            raspodela = static_cast<Raspodela>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+GeneratorUlaza::GeneratorUlaza(uint64_t seme, Raspodela raspodela)
+    : _seme(seme), _raspodela(raspodela), _generator(seme),
+      _imaNormalnu(false), _normalna(0)
+{}
+
+GeneratorUlaza &GeneratorUlaza::tekuci()
+{
+    static thread_local GeneratorUlaza generator(
+        (static_cast<uint64_t>(std::random_device{}()) << 32) ^ std::random_device{}());
+    return generator;
+}
+
+void GeneratorUlaza::postavi(uint64_t seme, Raspodela raspodela)
+{
+    _seme = seme;
+    _raspodela = raspodela;
+    _generator.seed(seme);
+    _imaNormalnu = false;
+}
+
+int GeneratorUlaza::stranicaOblasti(int brojObjekata, Raspodela raspodela)
+{
+    const double n = std::max(brojObjekata, 1);
+    const double stranica = raspodela == Raspodela::NA_KRUZNICI ? STRANICA_NA_KRUZNICI * n * n
+                                                                : STRANICA_PO_KORENU * std::sqrt(n);
+    return static_cast<int>(std::min<double>(std::max<double>(stranica, CANVAS_WIDTH),
+                                             NAJVECA_STRANICA_OBLASTI));
+}
+
+uint64_t GeneratorUlaza::seme() const
+{
+    return _seme;
+}
+
+Raspodela GeneratorUlaza::raspodela() const
+{
+    return _raspodela;
+}
+
+double GeneratorUlaza::uniformna()
+{
+    /* Gornja 53 bita daju ravnomerno rasporedjen double iz [0, 1) */
+    return (_generator() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+double GeneratorUlaza::normalna()
+{
+    if (_imaNormalnu) {
+        _imaNormalnu = false;
+        return _normalna;
+    }
+
+    /* Box-Muller; 1 - u je iz (0, 1], pa je logaritam konacan */
+    const double r = std::sqrt(-2 * std::log(1 - uniformna()));
+    const double ugao = 2 * PI * uniformna();
+    _normalna = r * std::sin(ugao);
+    _imaNormalnu = true;
+    return r * std::cos(ugao);
+}
+
+uint64_t GeneratorUlaza::ceo(uint64_t granica)
+{
+    return static_cast<uint64_t>(uniformna() * granica);
+}
+
+std::vector<GeneratorUlaza::Tacka2> GeneratorUlaza::tacke2D(int brojTacaka, double xMin, double xMax,
+                                                            double yMin, double yMax, bool celobrojne)
+{
+    std::vector<Tacka2> tacke;
+    tacke.reserve(static_cast<size_t>(std::max(brojTacaka, 0)));
+
+    const double cx = (xMin + xMax) / 2, cy = (yMin + yMax) / 2;
+    const double rx = (xMax - xMin) / 2, ry = (yMax - yMin) / 2;
+
+    /* Centri klastera se biraju iz istog niza brojeva, pre samih tacaka */
+    std::vector<Tacka2> centri;
+    if (_raspodela == Raspodela::GAUSOVI_KLASTERI)
+        for (int i = 0; i < BROJ_KLASTERA; i++)
+            centri.push_back({cx + 0.8 * rx * (2 * uniformna() - 1),
+                              cy + 0.8 * ry * (2 * uniformna() - 1)});
+
+    /* Krupna mreza sa oko sqrt(n) linija po osi */
+    const auto linijeMreze = std::max<uint64_t>(2, static_cast<uint64_t>(std::sqrt(std::max(brojTacaka, 0))));
+
+    for (int i = 0; i < brojTacaka; i++) {
+        Tacka2 t;
+        switch (_raspodela) {
+        case Raspodela::UNIFORMNA_KRUG: {
+            const double r = std::sqrt(uniformna());
+            const double ugao = 2 * PI * uniformna();
+            t = {cx + rx * r * std::cos(ugao), cy + ry * r * std::sin(ugao)};
+            break;
+        }
+        case Raspodela::NA_KRUZNICI: {
+            const double ugao = 2 * PI * uniformna();
+            t = {cx + rx * std::cos(ugao), cy + ry * std::sin(ugao)};
+            break;
+        }
+        case Raspodela::GAUSOVI_KLASTERI: {
+            const auto &centar = centri[ceo(centri.size())];
+            t = {centar.x + SIRINA_KLASTERA * 2 * rx * normalna(),
+                 centar.y + SIRINA_KLASTERA * 2 * ry * normalna()};
+            break;
+        }
+        case Raspodela::CELOBROJNA_MREZA: {
+            const double kx = static_cast<double>(ceo(linijeMreze)) / (linijeMreze - 1);
+            const double ky = static_cast<double>(ceo(linijeMreze)) / (linijeMreze - 1);
+            t = {xMin + kx * (xMax - xMin), yMin + ky * (yMax - yMin)};
+            break;
+        }
+        default:
+            t = {xMin + uniformna() * (xMax - xMin), yMin + uniformna() * (yMax - yMin)};
+            break;
+        }
+
+        t.x = std::min(std::max(t.x, xMin), xMax);
+        t.y = std::min(std::max(t.y, yMin), yMax);
+        if (celobrojne) {
+            t.x = std::round(t.x);
+            t.y = std::round(t.y);
+        }
+        tacke.push_back(t);
+    }
+
+    return tacke;
+}
+
+std::vector<GeneratorUlaza::Tacka3> GeneratorUlaza::tacke3D(int brojTacaka)
+{
+    std::vector<Tacka3> tacke;
+    tacke.reserve(static_cast<size_t>(std::max(brojTacaka, 0)));
+
+    std::vector<Tacka3> centri;
+    if (_raspodela == Raspodela::GAUSOVI_KLASTERI)
+        for (int i = 0; i < BROJ_KLASTERA; i++)
+            centri.push_back({0.1 + 0.8 * uniformna(), 0.1 + 0.8 * uniformna(), 0.1 + 0.8 * uniformna()});
+
+    const auto linijeMreze = std::max<uint64_t>(2, static_cast<uint64_t>(std::cbrt(std::max(brojTacaka, 0))));
+
+    for (int i = 0; i < brojTacaka; i++) {
+        Tacka3 t;
+        switch (_raspodela) {
+        case Raspodela::UNIFORMNA_KRUG:
+        case Raspodela::NA_KRUZNICI: {
+            /* Smer je normalizovan Gausov vektor, pa je uniforman na sferi */
+            double x, y, z, d;
+            do {
+                x = normalna();
+                y = normalna();
+                z = normalna();
+                d = std::sqrt(x*x + y*y + z*z);
+            } while (d == 0);
+            const double r = _raspodela == Raspodela::NA_KRUZNICI ? 1 : std::cbrt(uniformna());
+            t = {0.5 + 0.5 * r * x / d, 0.5 + 0.5 * r * y / d, 0.5 + 0.5 * r * z / d};
+            break;
+        }
+        case Raspodela::GAUSOVI_KLASTERI: {
+            const auto &centar = centri[ceo(centri.size())];
+            t = {centar.x + SIRINA_KLASTERA * normalna(),
+                 centar.y + SIRINA_KLASTERA * normalna(),
+                 centar.z + SIRINA_KLASTERA * normalna()};
+            break;
+        }
+        case Raspodela::CELOBROJNA_MREZA:
+            t = {static_cast<double>(ceo(linijeMreze)) / (linijeMreze - 1),
+                 static_cast<double>(ceo(linijeMreze)) / (linijeMreze - 1),
+                 static_cast<double>(ceo(linijeMreze)) / (linijeMreze - 1)};
+            break;
+        default:
+            t = {uniformna(), uniformna(), uniformna()};
+            break;
+        }
+
+        t.x = std::min(std::max(t.x, 0.), 1.);
+        t.y = std::min(std::max(t.y, 0.), 1.);
+        t.z = std::min(std::max(t.z, 0.), 1.);
+        tacke.push_back(t);
+    }
+
+    return tacke;
+}
+
+std::vector<GeneratorUlaza::Duz2> GeneratorUlaza::duzi(int brojDuzi, double xMin, double xMax,
+                                                       double yMin, double yMax, bool celobrojne)
+{
+    std::vector<Duz2> duzi;
+    duzi.reserve(static_cast<size_t>(std::max(brojDuzi, 0)));
+
+    /* Za raspodele tacaka, krajevi duzi su uzastopni parovi tacaka */
+    if (_raspodela != Raspodela::MESAVINA_DUZI) {
+        const auto tacke = tacke2D(2*brojDuzi, xMin, xMax, yMin, yMax, celobrojne);
+        for (auto i = 0ul; i + 1 < tacke.size(); i += 2)
+            duzi.push_back({tacke[i], tacke[i+1]});
+        return duzi;
+    }
+
+    const auto ogranici = [&](Tacka2 t) {
+        t.x = std::min(std::max(t.x, xMin), xMax);
+        t.y = std::min(std::max(t.y, yMin), yMax);
+        if (celobrojne) {
+            t.x = std::round(t.x);
+            t.y = std::round(t.y);
+        }
+        return t;
+    };
+
+    for (int i = 0; i < brojDuzi; i++) {
+        const Tacka2 p1 = {xMin + uniformna() * (xMax - xMin), yMin + uniformna() * (yMax - yMin)};
+        Tacka2 p2;
+        if (uniformna() < UDEO_DUGACKIH) {
+            p2 = {xMin + uniformna() * (xMax - xMin), yMin + uniformna() * (yMax - yMin)};
+        } else {
+            const double ugao = 2 * PI * uniformna();
+            const double duzina = DUZINA_KRATKIH * uniformna();
+            p2 = {p1.x + duzina * (xMax - xMin) * std::cos(ugao),
+                  p1.y + duzina * (yMax - yMin) * std::sin(ugao)};
+        }
+        duzi.push_back({ogranici(p1), ogranici(p2)});
+    }
+
+    return duzi;
+}
@@ -0,0 +1,92 @@
+#ifndef GENERATORULAZA_H
+#define GENERATORULAZA_H
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+/* Raspodele nasumicnih ulaza */
+enum class Raspodela {
+    UNIFORMNA_KVADRAT,  /* uniformno u pravougaoniku (kvadru) */
+    UNIFORMNA_KRUG,     /* uniformno u upisanom krugu (lopti) */
+    NA_KRUZNICI,        /* na upisanoj kruznici (sferi); sve tacke su na omotacu, osim
+                         * onih koje zaokruzivanje na malom kanvasu pomeri unutra */
+    GAUSOVI_KLASTERI,   /* nekoliko Gausovih klastera */
+    CELOBROJNA_MREZA,   /* cvorovi krupne mreze; mnogo kolinearnih i ponovljenih tacaka */
+    MESAVINA_DUZI,      /* duzi: vecinom kratke, uz nekoliko dugackih; tacke kao uniformne */
+    BROJ_RASPODELA
+};
+
+/* Do 2^30 su celobrojni predikati omotaca tacni i sa int32_t (config.h) */
+const int NAJVECA_STRANICA_OBLASTI = 1 << 30;
+
+const char *imeRaspodele(Raspodela raspodela);
+bool raspodelaIzImena(const std::string &ime, Raspodela &raspodela);
+
+///
+/// \brief The GeneratorUlaza class
+/// Ponovljivo generisanje nasumicnih ulaza: isti (64-bitno) seme i raspodela
+/// uvek daju iste ulaze, na svakoj platformi (mt19937_64 je potpuno odredjen
+/// standardom, a raspodele su implementirane ovde, a ne preko <random>).
+///
+/// Algoritmi uzimaju ulaze iz generatora tekuce niti (tekuci()); merenje
+/// performansi ga pre pravljenja algoritma postavlja na zeljeno seme i raspodelu.
+///
+class GeneratorUlaza
+{
+public:
+    struct Tacka2 { double x, y; };
+    struct Tacka3 { double x, y, z; };
+    struct Duz2 { Tacka2 p1, p2; };
+
+    GeneratorUlaza(uint64_t seme, Raspodela raspodela = Raspodela::UNIFORMNA_KVADRAT);
+
+    ///
+    /// \brief tekuci - generator tekuce niti; u pocetku ima nasumicno seme,
+    ///     pa uzastopni pozivi u GUI-ju daju razlicite ulaze
+    ///
+    static GeneratorUlaza &tekuci();
+
+    void postavi(uint64_t seme, Raspodela raspodela);
+    uint64_t seme() const;
+    Raspodela raspodela() const;
+
+    ///
+    /// \brief stranicaOblasti - stranica kvadrata celobrojnih 2D ulaza kada nema
+    ///     oblasti crtanja. Raste sa brojem objekata, da zaokruzivanje ne bi
+    ///     merenje pretvorilo u obradu ponovljenih tacaka: za raspodele po
+    ///     povrsini je oko 64*sqrt(n) (hiljade celobrojnih mesta po tacki), a
+    ///     na kruznici oko 8*n^2, pa zaokruzene tacke ostaju (uglavnom) u
+    ///     konveksnom polozaju; to staje ispod NAJVECA_STRANICA_OBLASTI za n do
+    ///     oko 10^4, a za vece n omotac i dalje raste sa n, ali sporije.
+    ///     Najmanje je velicina kanvasa, a najvise NAJVECA_STRANICA_OBLASTI.
+    ///
+    static int stranicaOblasti(int brojObjekata, Raspodela raspodela);
+
+    /* Tacke u [xMin, xMax] x [yMin, yMax], po potrebi zaokruzene na cele brojeve */
+    std::vector<Tacka2> tacke2D(int brojTacaka, double xMin, double xMax,
+                                double yMin, double yMax, bool celobrojne);
+
+    /* Tacke u jedinicnoj kocki [0, 1]^3 */
+    std::vector<Tacka3> tacke3D(int brojTacaka);
+
+    /* Duzi sa krajevima u [xMin, xMax] x [yMin, yMax] */
+    std::vector<Duz2> duzi(int brojDuzi, double xMin, double xMax,
+                           double yMin, double yMax, bool celobrojne);
+
+private:
+    double uniformna();
+    double normalna();
+    uint64_t ceo(uint64_t granica);
+
+    uint64_t _seme;
+    Raspodela _raspodela;
+    std::mt19937_64 _generator;
+
+    /* Box-Muller daje dve normalne vrednosti odjednom */
+    bool _imaNormalnu;
+    double _normalna;
+};
+
+#endif // GENERATORULAZA_H
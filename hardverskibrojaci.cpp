@@ -0,0 +1,163 @@
+#include "hardverskibrojaci.h"
+
+#include <sstream>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+double HardverskiBrojaci::Vrednosti::ipc() const
+{
+    return ciklusi ? static_cast<double>(instrukcije) / ciklusi : 0;
+}
+
+std::string HardverskiBrojaci::Vrednosti::opis() const
+{
+    if (!dostupni)
+        return "hardverski brojaci nedostupni";
+
+    std::ostringstream opis;
+    opis.precision(3);
+    opis << "ciklusi " << ciklusi << ", instrukcije " << instrukcije
+         << ", IPC " << ipc() << ", L1d promasaji " << l1Promasaji
+         << ", LLC promasaji " << llcPromasaji
+         << ", promasaji grananja " << promasajiGrananja;
+    return opis.str();
+}
+
+#ifdef __linux__
+
+namespace {
+
+int otvoriBrojac(uint32_t tip, uint64_t konfiguracija, int vodja)
+{
+    perf_event_attr atributi;
+    std::memset(&atributi, 0, sizeof(atributi));
+    atributi.size = sizeof(atributi);
+    atributi.type = tip;
+    atributi.config = konfiguracija;
+    atributi.disabled = vodja == -1;
+    /* Samo korisnicki rezim, sto je dozvoljeno i uz perf_event_paranoid = 2 */
+    atributi.exclude_kernel = 1;
+    atributi.exclude_hv = 1;
+    /* Niti napravljene tokom merenja se broje zajedno sa tekucom */
+    atributi.inherit = 1;
+    /* Uz vrednost se cita koliko je brojac bio ukljucen i koliko je zaista brojao */
+    atributi.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    /* Tekuca nit, bilo koje jezgro */
+    return static_cast<int>(syscall(__NR_perf_event_open, &atributi, 0, -1, vodja, 0));
+}
+
+uint64_t kesKonfiguracija(uint64_t kes, uint64_t operacija, uint64_t rezultat)
+{
+    return kes | (operacija << 8) | (rezultat << 16);
+}
+
+}
+
+HardverskiBrojaci::HardverskiBrojaci()
+{
+    /* Ciklusi vode grupu, pa se svi brojaci ukljucuju i iskljucuju zajedno */
+    _fd[CIKLUSI] = otvoriBrojac(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+    const int vodja = _fd[CIKLUSI];
+
+    if (vodja == -1) {
+        for (auto &fd : _fd)
+            fd = -1;
+        return;
+    }
+
+    _fd[INSTRUKCIJE] = otvoriBrojac(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, vodja);
+    _fd[L1_PROMASAJI] = otvoriBrojac(PERF_TYPE_HW_CACHE,
+                                     kesKonfiguracija(PERF_COUNT_HW_CACHE_L1D,
+                                                      PERF_COUNT_HW_CACHE_OP_READ,
+                                                      PERF_COUNT_HW_CACHE_RESULT_MISS), vodja);
+    _fd[LLC_PROMASAJI] = otvoriBrojac(PERF_TYPE_HW_CACHE,
+                                      kesKonfiguracija(PERF_COUNT_HW_CACHE_LL,
+                                                       PERF_COUNT_HW_CACHE_OP_READ,
+                                                       PERF_COUNT_HW_CACHE_RESULT_MISS), vodja);
+    _fd[PROMASAJI_GRANANJA] = otvoriBrojac(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, vodja);
+}
+
+HardverskiBrojaci::~HardverskiBrojaci()
+{
+    for (auto fd : _fd)
+        if (fd != -1)
+            close(fd);
+}
+
+bool HardverskiBrojaci::dostupni() const
+{
+    return _fd[CIKLUSI] != -1;
+}
+
+void HardverskiBrojaci::pokreni()
+{
+    if (!dostupni())
+        return;
+
+    ioctl(_fd[CIKLUSI], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_fd[CIKLUSI], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+HardverskiBrojaci::Vrednosti HardverskiBrojaci::zaustavi()
+{
+    Vrednosti v;
+    if (!dostupni())
+        return v;
+
+    ioctl(_fd[CIKLUSI], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    /* Vrednost, vreme ukljucenosti i vreme brojanja (read_format) */
+    bool potpuni = true;
+    const auto procitaj = [this, &potpuni](Brojac b) -> uint64_t {
+        uint64_t procitano[3] = {0, 0, 0};
+        if (_fd[b] == -1 || read(_fd[b], procitano, sizeof(procitano)) != sizeof(procitano))
+            return 0;
+        if (procitano[2] < procitano[1])
+            potpuni = false;
+        return procitano[0];
+    };
+
+    v.ciklusi = procitaj(CIKLUSI);
+    v.instrukcije = procitaj(INSTRUKCIJE);
+    v.l1Promasaji = procitaj(L1_PROMASAJI);
+    v.llcPromasaji = procitaj(LLC_PROMASAJI);
+    v.promasajiGrananja = procitaj(PROMASAJI_GRANANJA);
+
+    /* Grupa koja nije mogla stalno da bude na procesoru bi dala premale
+     * vrednosti, koje izgledaju kao prava merenja */
+    v.dostupni = potpuni;
+    return v;
+}
+
+#else
+
+/* Na ostalim sistemima brojaci nisu podrzani */
+HardverskiBrojaci::HardverskiBrojaci()
+{
+    for (auto &fd : _fd)
+        fd = -1;
+}
+
+HardverskiBrojaci::~HardverskiBrojaci() = default;
+
+bool HardverskiBrojaci::dostupni() const
+{
+    return false;
+}
+
+void HardverskiBrojaci::pokreni()
+{}
+
+HardverskiBrojaci::Vrednosti HardverskiBrojaci::zaustavi()
+{
+    return Vrednosti();
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef HARDVERSKIBROJACI_H
+#define HARDVERSKIBROJACI_H
+
+#include <cstdint>
+#include <string>
+
+///
+/// \brief The HardverskiBrojaci class
+/// Hardverski brojaci performansi (Linux perf_event_open) za nit koja ih
+/// je napravila: ciklusi, instrukcije, promasaji L1d i LLC kesa i promasaji
+/// predvidjanja grananja. Brojaci se nasledjuju, pa obuhvataju i niti koje ta
+/// nit pravi posle otvaranja brojaca (npr. paralelniOmotac, paketniOmotaci),
+/// kada se te niti zavrse; niti napravljene ranije se ne broje. Ako kernel ne
+/// dozvoljava brojace (npr. previsok perf_event_paranoid ili virtuelna
+/// masina), brojaci su nedostupni i merenje se svodi na vreme. Brojac koji
+/// procesor ne podrzava ostaje 0.
+///
+class HardverskiBrojaci
+{
+public:
+    struct Vrednosti {
+        bool dostupni = false;
+        uint64_t ciklusi = 0;
+        uint64_t instrukcije = 0;
+        uint64_t l1Promasaji = 0;
+        uint64_t llcPromasaji = 0;
+        uint64_t promasajiGrananja = 0;
+
+        double ipc() const;
+        std::string opis() const;
+    };
+
+    HardverskiBrojaci();
+    ~HardverskiBrojaci();
+
+    HardverskiBrojaci(const HardverskiBrojaci &) = delete;
+    HardverskiBrojaci& operator=(const HardverskiBrojaci &) = delete;
+
+    bool dostupni() const;
+
+    /* Resetovanje i pokretanje svih brojaca */
+    void pokreni();
+
+    /* Zaustavljanje brojaca i citanje vrednosti od poslednjeg pokreni(); ako
+     * grupa nije brojala sve vreme dok je bila ukljucena (deli brojace sa
+     * drugim merenjima), vrednosti su nepotpune i oznacene kao nedostupne */
+    Vrednosti zaustavi();
+
+private:
+    enum Brojac { CIKLUSI, INSTRUKCIJE, L1_PROMASAJI, LLC_PROMASAJI, PROMASAJI_GRANANJA, BROJ_BROJACA };
+
+    int _fd[BROJ_BROJACA];
+};
+
+#endif // HARDVERSKIBROJACI_H
@@ -1,8 +1,16 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 
+#include <algorithm>
+
 #include <QFileDialog>
+#include <QMessageBox>
 #include <QTextStream>
+#include <QDoubleValidator>
+#include <QIntValidator>
+#include <QtCharts/QAreaSeries>
+#include <QtCharts/QLogValueAxis>
+#include <QtCharts/QValueAxis>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent),
@@ -10,7 +18,10 @@ MainWindow::MainWindow(QWidget *parent)
       _pAlgoritamBaza(nullptr),
       _imeDatoteke(""),
       _duzinaPauze(DUZINA_PAUZE),
-      _brojSlucajnihObjekata(BROJ_SLUCAJNIH_OBJEKATA)
+      _brojSlucajnihObjekata(BROJ_SLUCAJNIH_OBJEKATA),
+      _najmanjeVreme(0),
+      _najveceVreme(0),
+      _mThread(nullptr)
 {
     ui->setupUi(this);
     ui->tipAlgoritma->insertSeparator(static_cast<int>(TipAlgoritma::SEPARATOR));
@@ -32,25 +43,49 @@ MainWindow::MainWindow(QWidget *parent)
     connect(ui->tabWidget, &QTabWidget::currentChanged,
             this, [this](int) {ui->statusBar->showMessage("");});
 
+    ui->minVelicina->setValidator(new QIntValidator(1, NAJVECA_VELICINA, this));
+    ui->maxVelicina->setValidator(new QIntValidator(1, NAJVECA_VELICINA, this));
+    ui->korakVelicina->setValidator(new QDoubleValidator(0, NAJVECA_VELICINA, 3, this));
+    on_nizVelicina_currentIndexChanged(ui->nizVelicina->currentIndex());
+
     /* Add chart */
-    QChart *chart = new QChart();
+    QChart *chart = _chart;
     _optimalSeries->append(0,0);
     _naiveSeries->append(0,0);
 
-    _optimalSeries->setName("Optimalni algoritam");
-    _naiveSeries->setName("Naivni algoritam");
+    _optimalSeries->setName(imeSerije("Optimalni", _optimalneTacke));
+    _naiveSeries->setName(imeSerije("Naivni", _naivneTacke));
+    _referentSeries->setName(imeSerije("Referentni", _referentneTacke));
+    _referentSeries->setVisible(false);
 
     chart->addSeries(_optimalSeries);
     chart->addSeries(_naiveSeries);
+    chart->addSeries(_referentSeries);
+
+    /* Opseg od najmanjeg do 90. percentila izmerenih vremena, u boji
+     * odgovarajuce medijane; razlika koja ostaje u opsegu je verovatno sum */
+    QAreaSeries *optimalOpseg = new QAreaSeries(_optimalGornja, _optimalDonja);
+    QAreaSeries *naiveOpseg = new QAreaSeries(_naiveGornja, _naiveDonja);
+    optimalOpseg->setName("Optimalni algoritam (min - p90)");
+    naiveOpseg->setName("Naivni algoritam (min - p90)");
+
+    const auto postaviBoju = [](QAreaSeries *opseg, const QColor &bojaMedijane) {
+        QColor boja = bojaMedijane;
+        boja.setAlpha(60);
+        opseg->setColor(boja);
+        opseg->setBorderColor(boja);
+    };
+    postaviBoju(optimalOpseg, _optimalSeries->color());
+    postaviBoju(naiveOpseg, _naiveSeries->color());
+
+    chart->addSeries(optimalOpseg);
+    chart->addSeries(naiveOpseg);
 
     chart->legend()->show();
 
-    chart->createDefaultAxes();
+    postaviOse(merenje::OpsegVelicina());
     chart->setTitle("Poredjenje efikasnosti");
 
-    chart->axes(Qt::Horizontal).back()->setRange(0, X_MAX_VAL);
-    chart->axes(Qt::Vertical).back()->setRange(0, Y_MAX_VAL);
-
     // Same formatting
     chart->setBackgroundVisible(false);
     chart->setPlotAreaBackgroundVisible(true);
@@ -66,6 +101,12 @@ MainWindow::MainWindow(QWidget *parent)
 
 MainWindow::~MainWindow()
 {
+    /* Nit za merenje se zaustavlja pre unistavanja prozora cije slotove poziva */
+    if (_mThread) {
+        _mThread->prekini();
+        _mThread->wait();
+        delete _mThread;
+    }
     delete ui;
 }
 
@@ -129,8 +170,7 @@ void MainWindow::on_Ponisti_dugme_clicked()
     ui->brojNasumicniTacaka->setPlaceholderText("Uneti broj nasumicnih tacaka, podrazumevana vrednost je 20.");
 
     _imeDatoteke = "";
-    _optimalSeries->clear();
-    _naiveSeries->clear();
+    obrisiSerije();
 }
 
 void MainWindow::on_Zapocni_dugme_clicked()
@@ -223,7 +263,9 @@ void MainWindow::on_tipAlgoritma_currentIndexChanged(int index)
 
         /* Postavljanje 2D ili 3D kao aktivne stranice  */
         if (tipAlgoritma == TipAlgoritma::_3D_ISCRTAVANJE ||
-            tipAlgoritma == TipAlgoritma::KONVEKSNI_OMOTAC_3D)
+            tipAlgoritma == TipAlgoritma::KONVEKSNI_OMOTAC_3D ||
+            tipAlgoritma == TipAlgoritma::KONVEKSNI_OMOTAC_3D_QUICKHULL ||
+            tipAlgoritma == TipAlgoritma::KONVEKSNI_OMOTAC_3D_KONFLIKTI)
         {
             ui->tabWidget->setCurrentIndex(TabIndex::ALGORITAM_3D);
         } else {
@@ -236,27 +278,231 @@ void MainWindow::on_tipAlgoritma_currentIndexChanged(int index)
 void MainWindow::on_merenjeButton_clicked()
 {
     ui->merenjeButton->setEnabled(false);
-    _optimalSeries->clear();
-    _naiveSeries->clear();
+    ui->sacuvajRezultateButton->setEnabled(false);
+    ui->osnovaButton->setEnabled(false);
+    obrisiSerije();
 
     ui->tabWidget->setCurrentIndex(TabIndex::POREDJENJE);
     TipAlgoritma tipAlgoritma = static_cast<TipAlgoritma>(ui->tipAlgoritma->currentIndex());
 
-    _mThread = new TimeMeasurementThread(tipAlgoritma, MIN_DIM, STEP, MAX_DIM);
+    const auto opseg = procitajOpseg();
+    if (!opseg.ispravan()) {
+        ui->statusBar->showMessage(QString("Neispravan opseg velicina (najveca dozvoljena velicina je %1).")
+                                   .arg(NAJVECA_VELICINA));
+        ui->merenjeButton->setEnabled(true);
+        return;
+    }
+    postaviOse(opseg);
+
+    TipAlgoritma referentni;
+    _referentSeries->setVisible(merenje::referentniAlgoritam(tipAlgoritma, referentni));
+
+    delete _mThread;
+    _mThread = new TimeMeasurementThread(tipAlgoritma, opseg);
     connect(_mThread, &TimeMeasurementThread::updateChart, this, &MainWindow::on_lineSeriesChange);
     connect(_mThread, &TimeMeasurementThread::finishChart, this, &MainWindow::on_chartFinished);
     _mThread->start();
+    ui->prekiniMerenjeButton->setEnabled(true);
+}
+
+void MainWindow::on_prekiniMerenjeButton_clicked()
+{
+    ui->prekiniMerenjeButton->setEnabled(false);
+    if (_mThread)
+        _mThread->prekini();
+}
+
+void MainWindow::on_lineSeriesChange(double dim, merenje::StatistikaMerenja optimal, merenje::StatistikaMerenja naive,
+                                     merenje::StatistikaMerenja referentni)
+{
+    /* Neizmerena varijanta se ne crta (nula ne postoji na logaritamskoj osi) */
+    if (optimal.brojMerenja) {
+        _optimalSeries->append(dim, optimal.medijana);
+        _optimalDonja->append(dim, optimal.min);
+        _optimalGornja->append(dim, optimal.p90);
+
+        _optimalneTacke.push_back({dim, optimal.medijana, optimal.velicinaIzlaza});
+        _optimalSeries->setName(imeSerije("Optimalni", _optimalneTacke));
+    }
+
+    if (naive.brojMerenja) {
+        _naiveSeries->append(dim, naive.medijana);
+        _naiveDonja->append(dim, naive.min);
+        _naiveGornja->append(dim, naive.p90);
+
+        _naivneTacke.push_back({dim, naive.medijana, naive.velicinaIzlaza});
+        _naiveSeries->setName(imeSerije("Naivni", _naivneTacke));
+    }
+
+    if (referentni.brojMerenja) {
+        _referentSeries->append(dim, referentni.medijana);
+
+        _referentneTacke.push_back({dim, referentni.medijana, referentni.velicinaIzlaza});
+        _referentSeries->setName(imeSerije("Referentni", _referentneTacke));
+    }
+
+    /* Vertikalna osa prati izmerena vremena */
+    for (const auto *s : {&optimal, &naive, &referentni}) {
+        if (!s->brojMerenja)
+            continue;
+        if (s->min > 0 && (_najmanjeVreme == 0 || s->min < _najmanjeVreme))
+            _najmanjeVreme = s->min;
+        _najveceVreme = std::max(_najveceVreme, s->p90);
+    }
+
+    auto *osaY = _chart->axes(Qt::Vertical).back();
+    if (qobject_cast<QLogValueAxis *>(osaY)) {
+        if (_najmanjeVreme > 0)
+            osaY->setRange(_najmanjeVreme / 2, _najveceVreme * 2);
+    } else if (_najveceVreme > 0) {
+        osaY->setRange(0, _najveceVreme * 1.1);
+    }
+}
+
+merenje::OpsegVelicina MainWindow::procitajOpseg() const
+{
+    merenje::OpsegVelicina opseg;
+    const bool geometrijski = ui->nizVelicina->currentIndex() == 1;
+
+    if (!ui->minVelicina->text().isEmpty())
+        opseg.min = ui->minVelicina->text().toInt();
+    if (!ui->maxVelicina->text().isEmpty())
+        opseg.max = ui->maxVelicina->text().toInt();
+
+    if (geometrijski)
+        opseg.faktor = ui->korakVelicina->text().isEmpty() ? 2 : ui->korakVelicina->text().toDouble();
+    else if (!ui->korakVelicina->text().isEmpty())
+        opseg.korak = ui->korakVelicina->text().toInt();
+
+    return opseg;
+}
+
+void MainWindow::postaviOse(const merenje::OpsegVelicina &opseg)
+{
+    for (auto *osa : _chart->axes()) {
+        _chart->removeAxis(osa);
+        delete osa;
+    }
+
+    QAbstractAxis *osaX;
+    QAbstractAxis *osaY;
+    if (opseg.logaritamski()) {
+        auto *logX = new QLogValueAxis();
+        logX->setLabelFormat("%g");
+        logX->setRange(opseg.min, opseg.max);
+        auto *logY = new QLogValueAxis();
+        logY->setLabelFormat("%g");
+        osaX = logX;
+        osaY = logY;
+    } else {
+        auto *linX = new QValueAxis();
+        linX->setRange(0, opseg.max);
+        auto *linY = new QValueAxis();
+        linY->setRange(0, Y_MAX_VAL);
+        osaX = linX;
+        osaY = linY;
+    }
+    osaX->setTitleText("broj objekata");
+    osaY->setTitleText("vreme [s]");
+
+    _chart->addAxis(osaX, Qt::AlignBottom);
+    _chart->addAxis(osaY, Qt::AlignLeft);
+    for (auto *serija : _chart->series()) {
+        serija->attachAxis(osaX);
+        serija->attachAxis(osaY);
+    }
+
+    _najmanjeVreme = 0;
+    _najveceVreme = 0;
 }
 
-void MainWindow::on_lineSeriesChange(double dim, double optimal, double naive)
+void MainWindow::on_nizVelicina_currentIndexChanged(int index)
 {
-    _optimalSeries->append(dim, optimal);
-    _naiveSeries->append(dim, naive);
+    /* Kod geometrijskog niza korak je faktor */
+    ui->korakVelicina->setPlaceholderText(index == 1 ? "faktor (2)" : QString("korak (%1)").arg(STEP));
+    ui->minVelicina->setPlaceholderText(QString("min (%1)").arg(MIN_DIM));
+    ui->maxVelicina->setPlaceholderText(QString("max (%1)").arg(MAX_DIM));
+}
+
+QString MainWindow::imeSerije(const char *varijanta, const std::vector<merenje::TackaSlozenosti> &tacke)
+{
+    const auto procena = merenje::proceniSlozenost(tacke);
+    QString ime = QString("%1 algoritam (medijana)").arg(varijanta);
+    if (procena.uspesna)
+        ime += QString(" ~ %1").arg(QString::fromStdString(procena.opis()));
+    return ime;
+}
+
+void MainWindow::obrisiSerije()
+{
+    _optimalSeries->clear();
+    _optimalDonja->clear();
+    _optimalGornja->clear();
+
+    _naiveSeries->clear();
+    _naiveDonja->clear();
+    _naiveGornja->clear();
+
+    _referentSeries->clear();
+
+    _optimalneTacke.clear();
+    _naivneTacke.clear();
+    _referentneTacke.clear();
+    _optimalSeries->setName(imeSerije("Optimalni", _optimalneTacke));
+    _naiveSeries->setName(imeSerije("Naivni", _naivneTacke));
+    _referentSeries->setName(imeSerije("Referentni", _referentneTacke));
 }
 
 void MainWindow::on_chartFinished()
 {
+    /* finishChart se salje na kraju run(), pa je nit (skoro) zavrsena */
+    _mThread->wait();
+    ui->prekiniMerenjeButton->setEnabled(false);
     ui->merenjeButton->setEnabled(true);
+    ui->sacuvajRezultateButton->setEnabled(!_mThread->rezultati().empty());
+    ui->osnovaButton->setEnabled(!_mThread->rezultati().empty());
+}
+
+void MainWindow::on_sacuvajRezultateButton_clicked()
+{
+    QString imeDatoteke = QFileDialog::getSaveFileName(this, tr("Cuvanje rezultata merenja"),
+                              "", tr("JSON (*.json);;CSV (*.csv)"));
+    if (imeDatoteke.isEmpty())
+        return;
+
+    /* Format se odredjuje po ekstenziji; CSV se moze ucitati kao osnova */
+    const bool sacuvano = imeDatoteke.endsWith(".csv", Qt::CaseInsensitive)
+            ? merenje::sacuvajCsv(_mThread->rezultati(), imeDatoteke.toStdString())
+            : merenje::sacuvajJson(_mThread->rezultati(), imeDatoteke.toStdString());
+
+    if (!sacuvano)
+        QMessageBox::warning(this, tr("Cuvanje rezultata"), tr("Datoteka ne moze da se upise."));
+}
+
+void MainWindow::on_osnovaButton_clicked()
+{
+    QString imeDatoteke = QFileDialog::getOpenFileName(this, tr("Osnova za poredjenje"),
+                              "", tr("CSV (*.csv)"));
+    if (imeDatoteke.isEmpty())
+        return;
+
+    std::vector<merenje::RezultatMerenja> osnova;
+    if (!merenje::ucitajCsv(imeDatoteke.toStdString(), osnova)) {
+        QMessageBox::warning(this, tr("Poredjenje sa osnovom"), tr("Osnova ne moze da se ucita."));
+        return;
+    }
+
+    const auto regresije = merenje::uporedi(osnova, _mThread->rezultati(), PRAG_REGRESIJE);
+    QString poruka;
+    QTextStream tok(&poruka);
+    tok << "Sporijih velicina (prag " << PRAG_REGRESIJE * 100 << "%): " << regresije.size();
+    for (const auto &r : regresije)
+        tok << "\n" << QString::fromStdString(merenje::opisRegresije(r));
+
+    if (regresije.empty())
+        QMessageBox::information(this, tr("Poredjenje sa osnovom"), poruka);
+    else
+        QMessageBox::warning(this, tr("Poredjenje sa osnovom"), poruka);
 }
 
 void MainWindow::na_krajuAnimacije()
@@ -294,10 +540,45 @@ void MainWindow::napraviNoviAlgoritam()
         _pAlgoritamBaza = new KonveksniOmotac(_pOblastCrtanja, _duzinaPauze, _naivni,
                                               _imeDatoteke, _brojSlucajnihObjekata);
         break;
+    case TipAlgoritma::KONVEKSNI_OMOTAC_MONOTONI_LANAC:
+        _pAlgoritamBaza = new KonveksniOmotac(_pOblastCrtanja, _duzinaPauze, _naivni,
+                                              _imeDatoteke, _brojSlucajnihObjekata,
+                                              {geometrija::StrategijaOmotaca::MONOTONI_LANAC});
+        break;
+    case TipAlgoritma::KONVEKSNI_OMOTAC_CEN:
+        _pAlgoritamBaza = new KonveksniOmotac(_pOblastCrtanja, _duzinaPauze, _naivni,
+                                              _imeDatoteke, _brojSlucajnihObjekata,
+                                              {geometrija::StrategijaOmotaca::CEN});
+        break;
+    case TipAlgoritma::KONVEKSNI_OMOTAC_PARALELNI:
+        _pAlgoritamBaza = new KonveksniOmotac(_pOblastCrtanja, _duzinaPauze, _naivni,
+                                              _imeDatoteke, _brojSlucajnihObjekata,
+                                              {geometrija::StrategijaOmotaca::PARALELNI});
+        break;
+    case TipAlgoritma::KONVEKSNI_OMOTAC_DINAMICKI:
+        _pAlgoritamBaza = new KonveksniOmotac(_pOblastCrtanja, _duzinaPauze, _naivni,
+                                              _imeDatoteke, _brojSlucajnihObjekata,
+                                              {geometrija::StrategijaOmotaca::DINAMICKI});
+        break;
+    case TipAlgoritma::KONVEKSNI_OMOTAC_QUICKHULL:
+        _pAlgoritamBaza = new KonveksniOmotac(_pOblastCrtanja, _duzinaPauze, _naivni,
+                                              _imeDatoteke, _brojSlucajnihObjekata,
+                                              {geometrija::StrategijaOmotaca::QUICKHULL});
+        break;
     case TipAlgoritma::KONVEKSNI_OMOTAC_3D:
         _pAlgoritamBaza = new KonveksniOmotac3D(_pOblastCrtanjaOpenGL, _duzinaPauze, _naivni,
                                                 _imeDatoteke, _brojSlucajnihObjekata);
         break;
+    case TipAlgoritma::KONVEKSNI_OMOTAC_3D_QUICKHULL:
+        _pAlgoritamBaza = new KonveksniOmotac3D(_pOblastCrtanjaOpenGL, _duzinaPauze, _naivni,
+                                                _imeDatoteke, _brojSlucajnihObjekata,
+                                                StrategijaOmotaca3D::QUICKHULL);
+        break;
+    case TipAlgoritma::KONVEKSNI_OMOTAC_3D_KONFLIKTI:
+        _pAlgoritamBaza = new KonveksniOmotac3D(_pOblastCrtanjaOpenGL, _duzinaPauze, _naivni,
+                                                _imeDatoteke, _brojSlucajnihObjekata,
+                                                StrategijaOmotaca3D::KONFLIKTI);
+        break;
     case TipAlgoritma::PRESECI_DUZI:
         _pAlgoritamBaza = new PreseciDuzi(_pOblastCrtanja, _duzinaPauze, _naivni,
                                           _imeDatoteke, _brojSlucajnihObjekata);
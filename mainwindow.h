@@ -6,7 +6,9 @@
 #include "oblastcrtanja.h"
 #include "oblastcrtanjaopengl.h"
 #include "config.h"
+#include "tipalgoritma.h"
 #include "timemeasurementthread.h"
+#include "slozenost.h"
 #include "./algoritmi_studentski_projekti/watchmanroute.h"
 
 /* Ovde ukljuciti zaglavlja novih algoritma. */
@@ -21,23 +23,6 @@
 
 //#include "ga06_presekPravougaonika.h"
 
-/* Enumeracija algoritama */
-enum class TipAlgoritma {
-    ALGORITMI_SA_VEZBI,
-    DEMO_ISCRTAVANJA,
-    BRISUCA_PRAVA,
-    _3D_ISCRTAVANJE,
-    KONVEKSNI_OMOTAC,
-    KONVEKSNI_OMOTAC_3D,
-    PRESECI_DUZI,
-    DCEL_DEMO,
-    TRIANGULACIJA,
-    SEPARATOR,
-    STUDENTSKI_PROJEKTI,
-    PRESEK_PRAVOUGAONIKA,
-    WATCHMAN_ROUTE
-};
-
 /* Enumeracija tabova */
 enum TabIndex {
     ALGORITAM_2D,
@@ -76,8 +61,13 @@ private slots:
 
     /* za Chart */
     void on_merenjeButton_clicked();
-    void on_lineSeriesChange(double dim, double optimal, double naive);
+    void on_lineSeriesChange(double dim, merenje::StatistikaMerenja optimal, merenje::StatistikaMerenja naive,
+                             merenje::StatistikaMerenja referentni);
     void on_chartFinished();
+    void on_prekiniMerenjeButton_clicked();
+    void on_sacuvajRezultateButton_clicked();
+    void on_osnovaButton_clicked();
+    void on_nizVelicina_currentIndexChanged(int index);
 
     void on_tipAlgoritma_currentIndexChanged(int index);
 
@@ -92,6 +82,17 @@ private:
 
     void napraviNoviAlgoritam();
 
+    void obrisiSerije();
+
+    /* Opseg velicina iz polja za poredjenje; prazno polje je podrazumevana vrednost */
+    merenje::OpsegVelicina procitajOpseg() const;
+
+    /* Linearne ili logaritamske ose, prema opsegu velicina */
+    void postaviOse(const merenje::OpsegVelicina &opseg);
+
+    /* Ime serije sa procenom slozenosti izmerenih tacaka, npr. "... ~ n log n, k = 1.08" */
+    static QString imeSerije(const char *varijanta, const std::vector<merenje::TackaSlozenosti> &tacke);
+
 private:
     Ui::MainWindow *ui;
 
@@ -104,9 +105,29 @@ private:
     int _brojSlucajnihObjekata;
 
     /* Chart deo */
+    QChart *const _chart = new QChart();
+
+    /* Najmanje pozitivno i najvece izmereno vreme, za opseg vertikalne ose */
+    double _najmanjeVreme;
+    double _najveceVreme;
+
     QLineSeries *const _naiveSeries = new QLineSeries();
     QLineSeries *const _optimalSeries = new QLineSeries();
 
+    /* Optimalni algoritam referentnog tipa (merenje::referentniAlgoritam), ako ga ima */
+    QLineSeries *const _referentSeries = new QLineSeries();
+
+    /* Granice opsega izmerenih vremena (min - p90) oko medijane */
+    QLineSeries *const _naiveDonja = new QLineSeries();
+    QLineSeries *const _naiveGornja = new QLineSeries();
+    QLineSeries *const _optimalDonja = new QLineSeries();
+    QLineSeries *const _optimalGornja = new QLineSeries();
+
+    /* Izmerene medijane, za procenu slozenosti prikazanu u legendi */
+    std::vector<merenje::TackaSlozenosti> _naivneTacke;
+    std::vector<merenje::TackaSlozenosti> _optimalneTacke;
+    std::vector<merenje::TackaSlozenosti> _referentneTacke;
+
     TimeMeasurementThread *_mThread;
 };
 
@@ -0,0 +1,364 @@
+#include "merenje.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <sstream>
+
+/* Ovde ukluciti zaglavlja novih algoritama. */
+#include "./algoritmi_sa_vezbi/ga00_demoiscrtavanja.h"
+#include "./algoritmi_sa_vezbi/ga01_brisucaprava.h"
+#include "./algoritmi_sa_vezbi/ga02_3discrtavanje.h"
+#include "./algoritmi_sa_vezbi/ga03_konveksniomotac.h"
+#include "./algoritmi_sa_vezbi/ga04_konveksniomotac3d.h"
+#include "./algoritmi_sa_vezbi/ga05_preseciduzi.h"
+#include "./algoritmi_sa_vezbi/ga07_triangulation.h"
+
+#include "./algoritmi_studentski_projekti/watchmanroute.h"
+
+//#include "ga06_presekPravougaonika.h"
+
+/* AlgoritamBaza cuva referencu na parametar naivnosti, pa
+ * on mora da nadzivi sve instance napravljene za merenje */
+static const bool NIJE_NAIVNI = false;
+
+/* Parametri omotaca iz merenja, uz strategiju koju odredjuje tip algoritma */
+static geometrija::ParametriOmotaca saStrategijom(geometrija::ParametriOmotaca parametri,
+                                                  geometrija::StrategijaOmotaca strategija)
+{
+    parametri.strategija = strategija;
+    return parametri;
+}
+
+AlgoritamBaza *merenje::napraviAlgoritam(TipAlgoritma tipAlgoritma, int brojObjekata,
+                                         const geometrija::ParametriOmotaca &omotac)
+{
+    /* Ovde kreirati instancu klase algoritma. */
+    switch (tipAlgoritma) {
+    case TipAlgoritma::DEMO_ISCRTAVANJA:
+        return new DemoIscrtavanja(nullptr, 0, NIJE_NAIVNI, "", brojObjekata);
+    case TipAlgoritma::BRISUCA_PRAVA:
+        return new BrisucaPrava(nullptr, 0, NIJE_NAIVNI, "", brojObjekata);
+    case TipAlgoritma::_3D_ISCRTAVANJE:
+        return new BrisucaPrava(nullptr, 0, NIJE_NAIVNI, "", brojObjekata);
+    case TipAlgoritma::KONVEKSNI_OMOTAC:
+        return new KonveksniOmotac(nullptr, 0, NIJE_NAIVNI, "", brojObjekata,
+                                   saStrategijom(omotac, geometrija::StrategijaOmotaca::GREM));
+    case TipAlgoritma::KONVEKSNI_OMOTAC_MONOTONI_LANAC:
+        return new KonveksniOmotac(nullptr, 0, NIJE_NAIVNI, "", brojObjekata,
+                                   saStrategijom(omotac, geometrija::StrategijaOmotaca::MONOTONI_LANAC));
+    case TipAlgoritma::KONVEKSNI_OMOTAC_CEN:
+        return new KonveksniOmotac(nullptr, 0, NIJE_NAIVNI, "", brojObjekata,
+                                   saStrategijom(omotac, geometrija::StrategijaOmotaca::CEN));
+    case TipAlgoritma::KONVEKSNI_OMOTAC_PARALELNI:
+        return new KonveksniOmotac(nullptr, 0, NIJE_NAIVNI, "", brojObjekata,
+                                   saStrategijom(omotac, geometrija::StrategijaOmotaca::PARALELNI));
+    case TipAlgoritma::KONVEKSNI_OMOTAC_DINAMICKI:
+        return new KonveksniOmotac(nullptr, 0, NIJE_NAIVNI, "", brojObjekata,
+                                   saStrategijom(omotac, geometrija::StrategijaOmotaca::DINAMICKI));
+    case TipAlgoritma::KONVEKSNI_OMOTAC_QUICKHULL:
+        return new KonveksniOmotac(nullptr, 0, NIJE_NAIVNI, "", brojObjekata,
+                                   saStrategijom(omotac, geometrija::StrategijaOmotaca::QUICKHULL));
+    case TipAlgoritma::KONVEKSNI_OMOTAC_3D:
+        return new KonveksniOmotac3D(nullptr, 0, NIJE_NAIVNI, "", brojObjekata);
+    case TipAlgoritma::KONVEKSNI_OMOTAC_3D_QUICKHULL:
+        return new KonveksniOmotac3D(nullptr, 0, NIJE_NAIVNI, "", brojObjekata,
+                                     StrategijaOmotaca3D::QUICKHULL);
+    case TipAlgoritma::KONVEKSNI_OMOTAC_3D_KONFLIKTI:
+        return new KonveksniOmotac3D(nullptr, 0, NIJE_NAIVNI, "", brojObjekata,
+                                     StrategijaOmotaca3D::KONFLIKTI);
+    case TipAlgoritma::PRESECI_DUZI:
+        return new PreseciDuzi(nullptr, 0, NIJE_NAIVNI, "", brojObjekata);
+    case TipAlgoritma::TRIANGULACIJA:
+        return new Triangulation(nullptr, 0, NIJE_NAIVNI, "", brojObjekata);
+    case TipAlgoritma::WATCHMAN_ROUTE:
+        return new WatchmanRoute(nullptr, 0, NIJE_NAIVNI, "", brojObjekata);
+   /* case TipAlgoritma::PRESEK_PRAVOUGAONIKA:
+        return new PresekPravougaonika(nullptr, 0, NIJE_NAIVNI, "", brojObjekata);*/
+    default:
+        return nullptr;
+    }
+}
+
+const std::vector<merenje::ImeAlgoritma> &merenje::imenaAlgoritama()
+{
+    /* Ovde dodati imena novih algoritama za komandnu liniju. */
+    static const std::vector<ImeAlgoritma> imena = {
+        {"demo_iscrtavanja", TipAlgoritma::DEMO_ISCRTAVANJA},
+        {"brisuca_prava", TipAlgoritma::BRISUCA_PRAVA},
+        {"konveksni_omotac", TipAlgoritma::KONVEKSNI_OMOTAC},
+        {"konveksni_omotac_monotoni_lanac", TipAlgoritma::KONVEKSNI_OMOTAC_MONOTONI_LANAC},
+        {"konveksni_omotac_cen", TipAlgoritma::KONVEKSNI_OMOTAC_CEN},
+        {"konveksni_omotac_paralelni", TipAlgoritma::KONVEKSNI_OMOTAC_PARALELNI},
+        {"konveksni_omotac_dinamicki", TipAlgoritma::KONVEKSNI_OMOTAC_DINAMICKI},
+        {"konveksni_omotac_quickhull", TipAlgoritma::KONVEKSNI_OMOTAC_QUICKHULL},
+        {"konveksni_omotac_3d", TipAlgoritma::KONVEKSNI_OMOTAC_3D},
+        {"konveksni_omotac_3d_quickhull", TipAlgoritma::KONVEKSNI_OMOTAC_3D_QUICKHULL},
+        {"konveksni_omotac_3d_konflikti", TipAlgoritma::KONVEKSNI_OMOTAC_3D_KONFLIKTI},
+        {"preseci_duzi", TipAlgoritma::PRESECI_DUZI},
+        {"triangulacija", TipAlgoritma::TRIANGULACIJA},
+        {"watchman_route", TipAlgoritma::WATCHMAN_ROUTE},
+    };
+    return imena;
+}
+
+const char *merenje::imeAlgoritma(TipAlgoritma tipAlgoritma)
+{
+    for (const auto &a : imenaAlgoritama())
+        if (a.tip == tipAlgoritma)
+            return a.ime;
+    return "";
+}
+
+bool merenje::referentniAlgoritam(TipAlgoritma tipAlgoritma, TipAlgoritma &referentni)
+{
+    /* Cenov prema Gremovom: na uniformnim raspodelama h ostaje malo pa Cen
+     * prestize Grema za velike n, a na na_kruznici h raste sa n (oblast ulaza
+     * raste sa n, GeneratorUlaza::stranicaOblasti), pa Grem ostaje brzi */
+    switch (tipAlgoritma) {
+    case TipAlgoritma::KONVEKSNI_OMOTAC_MONOTONI_LANAC:
+    case TipAlgoritma::KONVEKSNI_OMOTAC_CEN:
+    case TipAlgoritma::KONVEKSNI_OMOTAC_PARALELNI:
+    case TipAlgoritma::KONVEKSNI_OMOTAC_DINAMICKI:
+    case TipAlgoritma::KONVEKSNI_OMOTAC_QUICKHULL:
+        referentni = TipAlgoritma::KONVEKSNI_OMOTAC;
+        return true;
+    case TipAlgoritma::KONVEKSNI_OMOTAC_3D_QUICKHULL:
+    case TipAlgoritma::KONVEKSNI_OMOTAC_3D_KONFLIKTI:
+        referentni = TipAlgoritma::KONVEKSNI_OMOTAC_3D;
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool merenje::OpsegVelicina::geometrijski() const
+{
+    return faktor > 1;
+}
+
+bool merenje::OpsegVelicina::ispravan() const
+{
+    return min > 0 && max >= min && max <= NAJVECA_VELICINA &&
+           (geometrijski() || (faktor == 0 && korak > 0));
+}
+
+std::vector<int> merenje::OpsegVelicina::velicine() const
+{
+    std::vector<int> velicine;
+    if (!ispravan())
+        return velicine;
+
+    /* Racuna se u double, kako poslednji korak ne bi prekoracio int */
+    for (double n = min; n <= max; ) {
+        velicine.push_back(static_cast<int>(n));
+        if (geometrijski())
+            n = std::max(n + 1, std::round(n * faktor));
+        else
+            n += korak;
+    }
+    return velicine;
+}
+
+bool merenje::OpsegVelicina::logaritamski() const
+{
+    /* Geometrijski niz je ravnomeran tek na logaritamskoj osi */
+    return geometrijski() || max >= static_cast<long long>(min) * ODNOS_LOG_OSA;
+}
+
+merenje::StatistikaMerenja merenje::izracunajStatistiku(std::vector<double> vremena)
+{
+    StatistikaMerenja s;
+    if (vremena.empty())
+        return s;
+
+    std::sort(vremena.begin(), vremena.end());
+    const auto n = vremena.size();
+
+    /* Percentil linearnom interpolacijom izmedju susednih uzoraka */
+    const auto percentil = [&](double p) {
+        const double pozicija = p * (n - 1);
+        const auto i = static_cast<size_t>(pozicija);
+        if (i + 1 >= n)
+            return vremena.back();
+        return vremena[i] + (pozicija - i) * (vremena[i+1] - vremena[i]);
+    };
+
+    s.brojMerenja = static_cast<int>(n);
+    s.min = vremena.front();
+    s.medijana = percentil(0.5);
+    s.p90 = percentil(0.9);
+    s.p99 = percentil(0.99);
+
+    double suma = 0;
+    for (auto t : vremena)
+        suma += t;
+    s.prosek = suma / n;
+
+    double kvadrati = 0;
+    for (auto t : vremena)
+        kvadrati += (t - s.prosek) * (t - s.prosek);
+    s.standardnaDevijacija = n > 1 ? std::sqrt(kvadrati / (n - 1)) : 0;
+
+    return s;
+}
+
+uint64_t merenje::semeZaVelicinu(uint64_t seme, int brojObjekata)
+{
+    /* splitmix64 korak; bliska semena i velicine daju nepovezane ulaze */
+    uint64_t z = seme + 0x9E3779B97F4A7C15ull * (static_cast<uint64_t>(brojObjekata) + 1);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+bool merenje::izmeriJednom(TipAlgoritma tipAlgoritma, int brojObjekata, bool naivni,
+                          const ParametriMerenja &parametri, uint64_t seme,
+                          JednoMerenje &rezultat, HardverskiBrojaci *brojaci, bool pratiAlokacije)
+{
+    GeneratorUlaza::tekuci().postavi(seme, parametri.raspodela);
+    std::unique_ptr<AlgoritamBaza> pAlgoritam(napraviAlgoritam(tipAlgoritma, brojObjekata, parametri.omotac));
+    if (!pAlgoritam)
+        return false;
+
+    /* Brojaci i pracenje alokacija obuhvataju merenje vremena, kako njihovo
+     * ukljucivanje i iskljucivanje ne bi ulazilo u izmereno vreme; samo
+     * pracenje alokacija ipak usporava svaku alokaciju (izmeri ga zato
+     * pokrece u zasebnom izvrsavanju) */
+    if (pratiAlokacije)
+        PracenjeAlokacija::pokreni();
+    if (brojaci)
+        brojaci->pokreni();
+
+    /* steady_clock je monoton i meri stvarno proteklo vreme ove niti,
+     * za razliku od clock() koji sabira procesorsko vreme svih niti */
+    const auto pocetak = std::chrono::steady_clock::now();
+    pAlgoritam->postaviPrekid(parametri.budzet > 0
+                                  ? pocetak + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                        std::chrono::duration<double>(parametri.budzet))
+                                  : std::chrono::steady_clock::time_point::max(),
+                              parametri.prekid);
+    if (naivni)
+        pAlgoritam->pokreniNaivniAlgoritam();
+    else
+        pAlgoritam->pokreniAlgoritam();
+    const auto kraj = std::chrono::steady_clock::now();
+
+    if (brojaci)
+        rezultat.brojaci = brojaci->zaustavi();
+    rezultat.alokacije = pratiAlokacije ? PracenjeAlokacija::zaustavi() : PracenjeAlokacija::Vrednosti();
+
+    rezultat.vreme = std::chrono::duration<double>(kraj - pocetak).count();
+    rezultat.faze = pAlgoritam->faze();
+    rezultat.velicinaIzlaza = pAlgoritam->velicinaIzlaza();
+
+    /* Algoritam bez provera (AlgoritamBaza_updateCanvasAndBlock) se ne moze
+     * prekinuti, ali se prekoracenje budzeta ipak belezi */
+    rezultat.prekoraceno = pAlgoritam->prekinut() ||
+                           (parametri.budzet > 0 && rezultat.vreme > parametri.budzet);
+    return true;
+}
+
+merenje::StatistikaMerenja merenje::izmeri(TipAlgoritma tipAlgoritma, int brojObjekata, bool naivni,
+                                           const ParametriMerenja &parametri, uint64_t seme)
+{
+    JednoMerenje jedno;
+
+    /* Rezultat merenja koje je prekoracilo budzet */
+    StatistikaMerenja prekoraceno;
+    prekoraceno.prekoraceno = true;
+
+    /* Zagrevanje (kes, alokator, frekvencija procesora); ne ulazi u rezultat */
+    for (int i = 0; i < parametri.zagrevanja; i++) {
+        izmeriJednom(tipAlgoritma, brojObjekata, naivni, parametri,
+                     seme + static_cast<uint64_t>(i), jedno);
+        if (jedno.prekoraceno)
+            return prekoraceno;
+    }
+
+    /* Brojaci se otvaraju u niti koja meri, jer prate nju i niti koje ona pravi */
+    HardverskiBrojaci brojaci;
+    HardverskiBrojaci::Vrednosti ukupniBrojaci;
+    ukupniBrojaci.dostupni = brojaci.dostupni();
+    std::vector<double> vremena;
+    vremena.reserve(static_cast<size_t>(parametri.ponavljanja));
+    std::vector<AlgoritamBaza::Faza> ukupneFaze;
+    double ukupnaVelicinaIzlaza = 0;
+    for (int r = 0; r < parametri.ponavljanja; r++) {
+        if (!izmeriJednom(tipAlgoritma, brojObjekata, naivni, parametri,
+                          seme + static_cast<uint64_t>(r), jedno, &brojaci))
+            return StatistikaMerenja();
+        if (jedno.prekoraceno)
+            return prekoraceno;
+        vremena.push_back(jedno.vreme);
+        ukupnaVelicinaIzlaza += jedno.velicinaIzlaza;
+
+        /* Sabiranje faza po imenu; redosled je redosled prvog pojavljivanja */
+        for (const auto &faza : jedno.faze) {
+            auto it = std::find_if(ukupneFaze.begin(), ukupneFaze.end(), [&](const AlgoritamBaza::Faza &f) {
+                return std::strcmp(f.ime, faza.ime) == 0;
+            });
+            if (it == ukupneFaze.end()) {
+                ukupneFaze.push_back(faza);
+            } else {
+                it->trajanje += faza.trajanje;
+                if (faza.udeo >= 0)
+                    it->udeo += faza.udeo;
+            }
+        }
+
+        ukupniBrojaci.dostupni = ukupniBrojaci.dostupni && jedno.brojaci.dostupni;
+        ukupniBrojaci.ciklusi += jedno.brojaci.ciklusi;
+        ukupniBrojaci.instrukcije += jedno.brojaci.instrukcije;
+        ukupniBrojaci.l1Promasaji += jedno.brojaci.l1Promasaji;
+        ukupniBrojaci.llcPromasaji += jedno.brojaci.llcPromasaji;
+        ukupniBrojaci.promasajiGrananja += jedno.brojaci.promasajiGrananja;
+    }
+
+    auto statistika = izracunajStatistiku(vremena);
+    for (auto &faza : ukupneFaze) {
+        faza.trajanje /= parametri.ponavljanja;
+        if (faza.udeo >= 0)
+            faza.udeo /= parametri.ponavljanja;
+    }
+    statistika.faze = ukupneFaze;
+    statistika.velicinaIzlaza = ukupnaVelicinaIzlaza / parametri.ponavljanja;
+
+    const auto ponavljanja = static_cast<uint64_t>(parametri.ponavljanja);
+    ukupniBrojaci.ciklusi /= ponavljanja;
+    ukupniBrojaci.instrukcije /= ponavljanja;
+    ukupniBrojaci.l1Promasaji /= ponavljanja;
+    ukupniBrojaci.llcPromasaji /= ponavljanja;
+    ukupniBrojaci.promasajiGrananja /= ponavljanja;
+    statistika.brojaci = ukupniBrojaci;
+
+    /* Alokacije se prate u zasebnom izvrsavanju nad ulazom prvog ponavljanja;
+     * pracenje usporava svaku alokaciju, pa to vreme ne ulazi u statistiku */
+    if (parametri.pratiAlokacije &&
+        izmeriJednom(tipAlgoritma, brojObjekata, naivni, parametri, seme, jedno, nullptr, true))
+        statistika.alokacije = jedno.alokacije;
+
+    return statistika;
+}
+
+std::string merenje::opisFaza(const StatistikaMerenja &statistika)
+{
+    double ukupno = 0;
+    for (const auto &faza : statistika.faze)
+        ukupno += faza.trajanje;
+
+    std::ostringstream opis;
+    opis.precision(3);
+    for (const auto &faza : statistika.faze) {
+        if (&faza != &statistika.faze.front())
+            opis << ", ";
+        opis << faza.ime << ' ' << faza.trajanje * 1e3 << " ms";
+        if (ukupno > 0)
+            opis << " (" << static_cast<int>(100 * faza.trajanje / ukupno + 0.5) << "%)";
+        if (faza.udeo >= 0)
+            opis << " [udeo " << 100 * faza.udeo << "%]";
+    }
+    return opis.str();
+}
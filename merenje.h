@@ -0,0 +1,163 @@
+#ifndef MERENJE_H
+#define MERENJE_H
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "algoritambaza.h"
+#include "ga_core/konveksniomotac2d.h"
+#include "generatorulaza.h"
+#include "hardverskibrojaci.h"
+#include "pracenjealokacija.h"
+#include "tipalgoritma.h"
+
+/* Zajednicki deo merenja performansi, koji koriste i
+ * TimeMeasurementThread (GUI) i ga_bench (komandna linija). */
+namespace merenje {
+
+///
+/// \brief napraviAlgoritam - pravi instancu algoritma bez oblasti crtanja
+///     (nullptr), sa brojObjekata nasumicnih ulaznih objekata
+/// \param omotac - parametri algoritama konveksnog omotaca; strategiju odredjuje tip algoritma
+/// \return nullptr ako algoritam ne podrzava merenje
+///
+AlgoritamBaza *napraviAlgoritam(TipAlgoritma tipAlgoritma, int brojObjekata,
+                                const geometrija::ParametriOmotaca &omotac = geometrija::ParametriOmotaca());
+
+/* Ime algoritma u komandnoj liniji i sacuvanim rezultatima, npr. "konveksni_omotac" */
+struct ImeAlgoritma {
+    const char *ime;
+    TipAlgoritma tip;
+};
+
+/* Imena svih algoritama koji podrzavaju merenje */
+const std::vector<ImeAlgoritma> &imenaAlgoritama();
+
+/* Ime algoritma, ili "" ako algoritam ne podrzava merenje */
+const char *imeAlgoritma(TipAlgoritma tipAlgoritma);
+
+///
+/// \brief referentniAlgoritam - algoritam sa cijim se optimalnim algoritmom poredi
+///     optimalni algoritam tipa (npr. druge strategije omotaca sa Gremovim)
+/// \return false ako tip nema referentni algoritam
+///
+bool referentniAlgoritam(TipAlgoritma tipAlgoritma, TipAlgoritma &referentni);
+
+/* Rezime ponovljenih merenja jedne varijante za jednu velicinu ulaza (u sekundama) */
+struct StatistikaMerenja {
+    int brojMerenja = 0;
+    double min = 0;
+    double medijana = 0;
+    double p90 = 0;
+    double p99 = 0;
+    double prosek = 0;
+    double standardnaDevijacija = 0;
+
+    /* Prosecno trajanje faza (AlgoritamBaza_faza), ako se mere */
+    std::vector<AlgoritamBaza::Faza> faze;
+
+    /* Prosecne vrednosti hardverskih brojaca po izvrsavanju */
+    HardverskiBrojaci::Vrednosti brojaci;
+
+    /* Alokacije i vrhovi memorije jednog izvrsavanja nad ulazom prvog ponavljanja */
+    PracenjeAlokacija::Vrednosti alokacije;
+
+    /* Izvrsavanje je prekoracilo budzet (ili je prekinuto), pa statistika nije izmerena */
+    bool prekoraceno = false;
+
+    /* Prosecna velicina izlaza (AlgoritamBaza::velicinaIzlaza), 0 ako se ne meri */
+    double velicinaIzlaza = 0;
+};
+
+/* Rezultat jednog izvrsavanja */
+struct JednoMerenje {
+    double vreme = 0;
+    bool prekoraceno = false;
+    int velicinaIzlaza = 0;
+    std::vector<AlgoritamBaza::Faza> faze;
+    HardverskiBrojaci::Vrednosti brojaci;
+    PracenjeAlokacija::Vrednosti alokacije;
+};
+
+///
+/// \brief The OpsegVelicina struct
+/// Velicine ulaza jednog poredjenja: aritmeticki niz (min, min + korak, ...)
+/// ili, ako je faktor veci od 1, geometrijski niz (min, min * faktor, ...),
+/// zakljucno sa max.
+///
+struct OpsegVelicina {
+    int min = MIN_DIM;
+    int max = MAX_DIM;
+    int korak = STEP;
+    double faktor = 0;
+
+    bool geometrijski() const;
+    bool ispravan() const;
+    std::vector<int> velicine() const;
+
+    /* Geometrijski opseg, ili opseg od vise redova velicine, crta se na logaritamskim osama */
+    bool logaritamski() const;
+};
+
+struct ParametriMerenja {
+    int zagrevanja = BROJ_ZAGREVANJA;
+    int ponavljanja = BROJ_PONAVLJANJA;
+    Raspodela raspodela = Raspodela::UNIFORMNA_KVADRAT;
+
+    /* Najduze dozvoljeno jedno izvrsavanje, u sekundama (0 = bez ogranicenja) */
+    double budzet = BUDZET_IZVRSAVANJA;
+
+    /* Pracenje alokacija i vrha memorije (PracenjeAlokacija) u jednom dodatnom
+     * izvrsavanju posle merenih, pa ne utice na izmereno vreme */
+    bool pratiAlokacije = true;
+
+    /* Parametri algoritama konveksnog omotaca (npr. odbacivanje unutrasnjih tacaka) */
+    geometrija::ParametriOmotaca omotac;
+
+    /* Spoljasnji zahtev za prekid merenja (npr. zatvaranje prozora); nullptr ako ga nema */
+    const std::atomic<bool> *prekid = nullptr;
+};
+
+///
+/// \brief semeZaVelicinu - seme ulaza velicine brojObjekata, izvedeno iz pocetnog
+///     semena merenja; zavisi samo od ta dva broja, pa se svaka velicina
+///     moze ponoviti zasebno (ponavljanje r koristi semeZaVelicinu(...) + r)
+///
+uint64_t semeZaVelicinu(uint64_t seme, int brojObjekata);
+
+StatistikaMerenja izracunajStatistiku(std::vector<double> vremena);
+
+///
+/// \brief izmeriJednom - jedno izvrsavanje: vreme (monotoni sat, u sekundama),
+///     faze, alokacije (ako je pratiAlokacije) i, ako su zadati i dostupni,
+///     hardverski brojaci. Pracenje alokacija usporava svaku alokaciju, pa
+///     izmereno vreme tada nije merodavno.
+///     Ulaz se generise sa zadatim semenom i raspodelom, van merenog dela.
+///     Izvrsavanje duze od budzeta se prekida (AlgoritamBaza::postaviPrekid)
+///     i oznacava kao prekoraceno.
+/// \return false ako algoritam ne podrzava merenje
+///
+bool izmeriJednom(TipAlgoritma tipAlgoritma, int brojObjekata, bool naivni,
+                  const ParametriMerenja &parametri, uint64_t seme,
+                  JednoMerenje &rezultat, HardverskiBrojaci *brojaci = nullptr,
+                  bool pratiAlokacije = false);
+
+///
+/// \brief izmeri - zagrevanje, pa ponovljeno merenje nad svezim ulazima
+///     Ponavljanje r koristi seme (seme + r), pa optimalni i naivni
+///     algoritam sa istim semenom vide iste ulaze. Prvo izvrsavanje koje
+///     prekoraci budzet zavrsava merenje, a rezultat je oznacen kao prekoracen.
+///     Alokacije se, ako se prate, mere u jednom dodatnom izvrsavanju koje
+///     ne ulazi u vremena.
+///
+StatistikaMerenja izmeri(TipAlgoritma tipAlgoritma, int brojObjekata, bool naivni,
+                         const ParametriMerenja &parametri, uint64_t seme);
+
+/* Tekstualni prikaz faza, npr. "sortiranje 1.2 ms (81%), skeniranje 0.3 ms (19%)";
+ * faza koja prijavljuje udeo ima i "[udeo 97%]" */
+std::string opisFaza(const StatistikaMerenja &statistika);
+
+}
+
+#endif // MERENJE_H
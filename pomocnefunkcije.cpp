@@ -2,72 +2,55 @@
 
 #include <QtGlobal>
 
-int pomocneFunkcije::povrsinaTrougla(const QPoint& A, const QPoint& B, const QPoint& C)
+int64_t pomocneFunkcije::povrsinaTrougla(const QPoint& A, const QPoint& B, const QPoint& C)
 {
     /* (Dvostruka) Povrsina trougla.
      * 2P(Trougla) = |ax ay 1|
      *               |bx by 1|
      *               |cx cy 1|
      */
-    return (B.x() - A.x())*(C.y() - A.y()) - (C.x() - A.x())*(B.y() - A.y());
+    return povrsinaTrougla<int32_t>(A.x(), A.y(), B.x(), B.y(), C.x(), C.y());
 }
 
-int pomocneFunkcije::distanceKvadrat(const QPoint& A, const QPoint& B)
+int64_t pomocneFunkcije::distanceKvadrat(const QPoint& A, const QPoint& B)
 {
-    return (A.x() - B.x())*(A.x() - B.x()) + (A.y() - B.y())*(A.y() - B.y());
+    return distanceKvadrat<int32_t>(A.x(), A.y(), B.x(), B.y());
 }
 
 bool pomocneFunkcije::kolinearne3D(const QVector3D& a, const QVector3D& b, const QVector3D& c)
 {
-    /* Proverava se povrsina trougla. Zaparvo da li su sva tri unakrsna proizvoda
-     * vektora jednaki nuli.
-     * Kako je u pitanju float vrednost, gledamo da li je apsultna vrednost manja od
-     * nekog malog broja.
-     * Tj. proveravamo sledece
+    /* Tacke su kolinearne ako je vektorski proizvod (b - a) x (c - a) nula,
+     * tj. ako su kolinearne sve tri projekcije na koordinatne ravni.
      * |  i      j      k  |
-     * |ax-bx  ay-by  az-bz| = (0, 0, 0)
-     * |ax-cx  ay-cy  az-cz|
+     * |bx-ax  by-ay  bz-az| = (0, 0, 0)
+     * |cx-ax  cy-ay  cz-az|
+     * Provera je tacna, bez tolerancije; float koordinate su tacno predstavljive u double.
      */
-    return (fabsf((c.z() - a.z()) * (b.y() - a.y()) -
-              (b.z() - a.z()) * (c.y() - a.y())) < EPSf) &&
-           (fabsf((b.z() - a.z()) * (c.x() - a.x()) -
-              (b.x() - a.x()) * (c.z() - a.z())) < EPSf) &&
-           (fabsf((b.x() - a.x()) * (c.y() - a.y()) -
-              (b.y() - a.y()) * (c.x() - a.x())) < EPSf);
+    return orijentacija(a.x(), a.y(), b.x(), b.y(), c.x(), c.y()) == 0 &&
+           orijentacija(a.y(), a.z(), b.y(), b.z(), c.y(), c.z()) == 0 &&
+           orijentacija(a.z(), a.x(), b.z(), b.x(), c.z(), c.x()) == 0;
 }
 
-
-float pomocneFunkcije::zapremina(const QVector3D& a, const QVector3D& b, const QVector3D& c, const QVector3D& d)
+double pomocneFunkcije::orijentacija3D(const QVector3D& a, const QVector3D& b, const QVector3D& c, const QVector3D& d)
 {
-    /* Zapremina se racuna kao determinanta
-     * 6V(Tetraedar) = |ax ay az 1|
-     *                 |bx by bz 1|
-     *                 |cx cy cz 1|
-     *                 |dx dy dz 1|
-     */
-    float bxdx = b.x() - d.x();
-    float bydy = b.y() - d.y();
-    float bzdz = b.z() - d.z();
-    float cxdx = c.x() - d.x();
-    float cydy = c.y() - d.y();
-    float czdz = c.z() - d.z();
-    float vol =    (a.z() - d.z()) * (bxdx*cydy - bydy*cxdx)
-                +  (a.y() - d.y()) * (bzdz*cxdx - bxdx*czdz)
-                +  (a.x() - d.x()) * (bydy*czdz - bzdz*cydy);
+    return orijentacija3D(a.x(), a.y(), a.z(), b.x(), b.y(), b.z(),
+                          c.x(), c.y(), c.z(), d.x(), d.y(), d.z());
+}
 
-    if (fabsf(vol) < EPSf)
-        return 0;
-    else
-        return vol;
+double pomocneFunkcije::zapremina(const QVector3D& a, const QVector3D& b, const QVector3D& c, const QVector3D& d)
+{
+    /* Racuna se u double-u; nula je samo ako su tacke zaista komplanarne */
+    return orijentacija3D(a, b, c, d);
 }
 
 bool pomocneFunkcije::presekDuzi(const QLineF& l1, const QLineF& l2, QPointF& presek)
 {
-#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-    return l1.intersects(l2, &presek) == QLineF::BoundedIntersection;
-#else
-    return l1.intersect(l2, &presek) == QLineF::BoundedIntersection;
-#endif
+    double x, y;
+    if (!geometrija::presek(uDuz(l1), uDuz(l2), x, y))
+        return false;
+
+    presek = QPointF(x, y);
+    return true;
 }
 
 double pomocneFunkcije::distanceKvadratF(const QPointF& A, const QPointF& B)
@@ -78,9 +61,10 @@ double pomocneFunkcije::distanceKvadratF(const QPointF& A, const QPointF& B)
 // da li je A ispod B
 bool pomocneFunkcije::ispod(const QPointF &A, const QPointF &B)
 {
+    /* Poredjenje je tacno, bez tolerancije, kako bi poredak bio tranzitivan */
     if(A.y() < B.y())
         return true;
-    else if(fabs(A.y() - B.y()) < EPS)
+    else if(A.y() == B.y())
     {
        if(A.x() > B.x()) return true;
     }
@@ -89,9 +73,19 @@ bool pomocneFunkcije::ispod(const QPointF &A, const QPointF &B)
 
 bool pomocneFunkcije::konveksan(const QPointF &A, const QPointF &B, const QPointF &C)
 {
-    double P = (B.x() - A.x())*(C.y() - A.y()) - (C.x() - A.x())*(B.y() - A.y());
+    double P = orijentacija(A, B, C);
 
      return (P > 0) ||
-            (fabs(P) < EPS && pomocneFunkcije::distanceKvadratF(A, B)
-                            < pomocneFunkcije::distanceKvadratF(A, C));
+            (P == 0 && pomocneFunkcije::distanceKvadratF(A, B)
+                     < pomocneFunkcije::distanceKvadratF(A, C));
+}
+
+double pomocneFunkcije::orijentacija(const QPointF &A, const QPointF &B, const QPointF &C)
+{
+    return orijentacija(A.x(), A.y(), B.x(), B.y(), C.x(), C.y());
+}
+
+double pomocneFunkcije::uKrugu(const QPointF &A, const QPointF &B, const QPointF &C, const QPointF &D)
+{
+    return uKrugu(A.x(), A.y(), B.x(), B.y(), C.x(), C.y(), D.x(), D.y());
 }
@@ -5,20 +5,42 @@
 #include <QLineF>
 #include <QVector3D>
 #include <cmath>
+#include <cstdint>
 
 #include <config.h>
 
+#include "ga_core/predikati.h"
+#include "ga_core/presekduzi.h"
+
+/* Predikati nad Qt tipovima; racunanje je u ga_core (geometrija), ovde su
+ * samo omotaci oko QPoint, QPointF i QVector3D. */
 namespace pomocneFunkcije {
-int povrsinaTrougla(const QPoint& A, const QPoint& B, const QPoint& C);
-int distanceKvadrat(const QPoint& A, const QPoint& B);
+using geometrija::Siroki;
+using geometrija::povrsinaTrougla;
+using geometrija::distanceKvadrat;
+using geometrija::orijentacija;
+using geometrija::orijentacija3D;
+using geometrija::uKrugu;
+
+int64_t povrsinaTrougla(const QPoint& A, const QPoint& B, const QPoint& C);
+int64_t distanceKvadrat(const QPoint& A, const QPoint& B);
+/* Presek duzi (geometrija::presek); tacka se racuna samo ako se duzi seku */
 bool presekDuzi(const QLineF& l1, const QLineF& l2, QPointF& presek);
+inline geometrija::Duz uDuz(const QLineF& l) { return {l.x1(), l.y1(), l.x2(), l.y2()}; }
 double distanceKvadratF(const QPointF& A, const QPointF& B);
 bool ispod(const QPointF& A, const QPointF& B);
 bool konveksan(const QPointF& A, const QPointF& B, const QPointF& C);
 
+/* Robusni predikati (geometrija::orijentacija, geometrija::uKrugu) nad tackama */
+double orijentacija(const QPointF& A, const QPointF& B, const QPointF& C);
+double uKrugu(const QPointF& A, const QPointF& B, const QPointF& C, const QPointF& D);
+
 /* Pomocni metodi za 3D. */
 bool kolinearne3D(const QVector3D& a, const QVector3D& b, const QVector3D& c);
-float zapremina(const QVector3D& a, const QVector3D& b, const QVector3D& c, const QVector3D& d);
+
+/* Sestostruka zapremina tetraedra abcd sa tacnim znakom; 0 ako su tacke komplanarne */
+double orijentacija3D(const QVector3D& a, const QVector3D& b, const QVector3D& c, const QVector3D& d);
+double zapremina(const QVector3D& a, const QVector3D& b, const QVector3D& c, const QVector3D& d);
 }
 
 #endif // POMOCNEFUNKCIJE_H
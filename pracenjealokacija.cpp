@@ -0,0 +1,215 @@
+#include "pracenjealokacija.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <sstream>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#define ZIVI_BAJTOVI_DOSTUPNI 1
+#else
+#define ZIVI_BAJTOVI_DOSTUPNI 0
+#endif
+
+namespace {
+
+/* Stanje procesa, zajednicko za sve niti. Atomici bez konstruktora sa
+ * nulom su spremni i pre prve alokacije (staticka inicijalizacija), a
+ * redosled medju nitima nije bitan, pa su sve operacije relaksirane. */
+struct Stanje {
+    std::atomic<bool> aktivno;
+    std::atomic<uint64_t> alokacije;
+    std::atomic<uint64_t> bajtova;
+    std::atomic<int64_t> zivihBajtova;
+    std::atomic<int64_t> vrhZivihBajtova;
+};
+
+Stanje stanje = {{false}, {0}, {0}, {0}, {0}};
+
+inline size_t velicinaBloka(void *p, size_t trazeno)
+{
+#if ZIVI_BAJTOVI_DOSTUPNI
+    (void)trazeno;
+    return malloc_usable_size(p);
+#else
+    (void)p;
+    return trazeno;
+#endif
+}
+
+inline void zabeleziAlokaciju(void *p, size_t trazeno)
+{
+    if (!stanje.aktivno.load(std::memory_order_relaxed) || !p)
+        return;
+
+    const auto velicina = velicinaBloka(p, trazeno);
+    stanje.alokacije.fetch_add(1, std::memory_order_relaxed);
+    stanje.bajtova.fetch_add(velicina, std::memory_order_relaxed);
+    const auto zivih = stanje.zivihBajtova.fetch_add(static_cast<int64_t>(velicina),
+                                                     std::memory_order_relaxed)
+                       + static_cast<int64_t>(velicina);
+    auto vrh = stanje.vrhZivihBajtova.load(std::memory_order_relaxed);
+    while (zivih > vrh && !stanje.vrhZivihBajtova.compare_exchange_weak(vrh, zivih, std::memory_order_relaxed))
+        ;
+}
+
+inline void zabeleziOslobadjanje(void *p)
+{
+    /* Blok alociran pre pokreni() umanjuje zive bajtove, pa oni mogu biti negativni */
+    if (!stanje.aktivno.load(std::memory_order_relaxed) || !p)
+        return;
+#if ZIVI_BAJTOVI_DOSTUPNI
+    stanje.zivihBajtova.fetch_sub(static_cast<int64_t>(malloc_usable_size(p)), std::memory_order_relaxed);
+#endif
+}
+
+void *alociraj(size_t velicina)
+{
+    void *p = std::malloc(velicina ? velicina : 1);
+    zabeleziAlokaciju(p, velicina);
+    return p;
+}
+
+void oslobodi(void *p)
+{
+    zabeleziOslobadjanje(p);
+    std::free(p);
+}
+
+#ifdef __linux__
+/* "VmHWM:   12345 kB" iz /proc/self/status */
+uint64_t procitajVrhRss()
+{
+    std::ifstream status("/proc/self/status");
+    std::string red;
+    while (std::getline(status, red)) {
+        if (red.compare(0, 6, "VmHWM:") == 0)
+            return std::strtoull(red.c_str() + 6, nullptr, 10) * 1024;
+    }
+
+    rusage upotreba;
+    if (getrusage(RUSAGE_SELF, &upotreba) == 0)
+        return static_cast<uint64_t>(upotreba.ru_maxrss) * 1024;
+    return 0;
+}
+
+void ponistiVrhRss()
+{
+    /* Dostupno od Linuksa 4.0; ako ne uspe, vrh je vrh od pocetka procesa */
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+}
+#else
+uint64_t procitajVrhRss()
+{
+    return 0;
+}
+
+void ponistiVrhRss()
+{}
+#endif
+
+}
+
+void *operator new(size_t velicina)
+{
+    if (void *p = alociraj(velicina))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](size_t velicina)
+{
+    if (void *p = alociraj(velicina))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new(size_t velicina, const std::nothrow_t &) noexcept
+{
+    return alociraj(velicina);
+}
+
+void *operator new[](size_t velicina, const std::nothrow_t &) noexcept
+{
+    return alociraj(velicina);
+}
+
+void operator delete(void *p) noexcept
+{
+    oslobodi(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    oslobodi(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    oslobodi(p);
+}
+
+void operator delete[](void *p, size_t) noexcept
+{
+    oslobodi(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept
+{
+    oslobodi(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept
+{
+    oslobodi(p);
+}
+
+std::string PracenjeAlokacija::Vrednosti::opis(int brojObjekata) const
+{
+    if (!dostupno)
+        return "alokacije se ne prate";
+
+    std::ostringstream opis;
+    opis.precision(3);
+    opis << "alokacije " << alokacije;
+    if (brojObjekata > 0)
+        opis << " (" << static_cast<double>(alokacije) / brojObjekata << "/element)";
+    opis << ", " << bajtova / 1e6 << " MB";
+    if (ZIVI_BAJTOVI_DOSTUPNI)
+        opis << ", vrh zivih " << vrhZivihBajtova / 1e6 << " MB";
+    if (vrhRss)
+        opis << ", vrh RSS " << vrhRss / 1e6 << " MB";
+    return opis.str();
+}
+
+void PracenjeAlokacija::pokreni()
+{
+    ponistiVrhRss();
+    stanje.alokacije.store(0, std::memory_order_relaxed);
+    stanje.bajtova.store(0, std::memory_order_relaxed);
+    stanje.zivihBajtova.store(0, std::memory_order_relaxed);
+    stanje.vrhZivihBajtova.store(0, std::memory_order_relaxed);
+    stanje.aktivno.store(true, std::memory_order_relaxed);
+}
+
+PracenjeAlokacija::Vrednosti PracenjeAlokacija::zaustavi()
+{
+    stanje.aktivno.store(false, std::memory_order_relaxed);
+
+    /* Niti koje je algoritam napravio su zavrsene (join), pa su njihove
+     * alokacije vec upisane */
+    Vrednosti v;
+    v.dostupno = true;
+    v.alokacije = stanje.alokacije.load(std::memory_order_relaxed);
+    v.bajtova = stanje.bajtova.load(std::memory_order_relaxed);
+    v.vrhZivihBajtova = static_cast<uint64_t>(stanje.vrhZivihBajtova.load(std::memory_order_relaxed));
+    v.vrhRss = procitajVrhRss();
+    return v;
+}
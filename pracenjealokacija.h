@@ -0,0 +1,42 @@
+#ifndef PRACENJEALOKACIJA_H
+#define PRACENJEALOKACIJA_H
+
+#include <cstdint>
+#include <string>
+
+///
+/// \brief The PracenjeAlokacija class
+/// Pracenje dinamickih alokacija celog procesa: globalni operator new i delete
+/// su zamenjeni (pracenjealokacija.cpp) i, dok je pracenje pokrenuto, broje pozive,
+/// alocirane bajtove i najveci broj istovremeno zauzetih bajtova, u svim nitima
+/// (npr. i u nitima paralelniOmotac i paketniOmotaci). Van pracenja je cena
+/// zamene jedno relaksirano citanje po alokaciji; tokom pracenja alokacije
+/// placaju i malloc_usable_size i atomicke operacije, pa ga merenje vremena
+/// ne ukljucuje (merenje::izmeri prati alokacije u zasebnom izvrsavanju).
+///
+/// Zauzeti bajtovi se mere preko malloc_usable_size (glibc); na ostalim sistemima
+/// se broje samo alokacije. Vrh RSS-a je vrh celog procesa, a na Linuksu se pre
+/// svakog pracenja ponistava (/proc/self/clear_refs), pa odgovara jednom izvrsavanju.
+///
+class PracenjeAlokacija
+{
+public:
+    struct Vrednosti {
+        bool dostupno = false;
+        uint64_t alokacije = 0;         /* broj poziva operatora new */
+        uint64_t bajtova = 0;           /* ukupno alocirano */
+        uint64_t vrhZivihBajtova = 0;   /* najvise istovremeno zauzetih, od pokreni() */
+        uint64_t vrhRss = 0;            /* vrh RSS-a procesa u bajtovima, 0 ako nije poznat */
+
+        /* Npr. "alokacije 3.2/element, 1.1 MB, vrh 0.4 MB, vrh RSS 25 MB" */
+        std::string opis(int brojObjekata) const;
+    };
+
+    /* Ponistavanje brojaca i pocetak pracenja; ne sme se preklapati sa drugim pracenjem */
+    static void pokreni();
+
+    /* Kraj pracenja i vrednosti od poslednjeg pokreni() */
+    static Vrednosti zaustavi();
+};
+
+#endif // PRACENJEALOKACIJA_H
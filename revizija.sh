@@ -0,0 +1,23 @@
+#!/bin/sh
+# Pravi revizija.cpp sa git revizijom koda; algoritmi.pri ga poziva pri svakom
+# prevodjenju. Datoteka se prepisuje samo kada se revizija promeni, pa se tada
+# (i samo tada) ponovo prevodi.
+#
+# Upotreba: revizija.sh DIREKTORIJUM_IZVORA IZLAZNA_DATOTEKA
+
+izvor=$1
+izlaz=$2
+
+revizija=$(git -C "$izvor" describe --always --dirty 2> /dev/null)
+[ -n "$revizija" ] || revizija=nepoznata
+
+novo="#include \"rezultatimerenja.h\"
+
+const char *merenje::revizijaKoda()
+{
+    return \"$revizija\";
+}"
+
+if [ ! -f "$izlaz" ] || [ "$(cat "$izlaz")" != "$novo" ]; then
+    printf '%s\n' "$novo" > "$izlaz"
+fi
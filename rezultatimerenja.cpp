@@ -0,0 +1,349 @@
+#include "rezultatimerenja.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+
+/* Bez revizija.cpp (algoritmi.pri) revizija se postavlja pri pokretanju qmake-a */
+#if !defined(REVIZIJA_PRI_PREVODJENJU) && !defined(GIT_REVIZIJA)
+#define GIT_REVIZIJA "nepoznata"
+#endif
+
+namespace {
+
+const char *const KOLONE_CSV[] = {
+    "algoritam", "varijanta", "n", "seme", "raspodela", "oblast", "revizija",
+    "prekoraceno", "broj_merenja", "min", "medijana", "p90", "p99", "prosek", "sd",
+    "ciklusi", "instrukcije", "l1_promasaji", "llc_promasaji", "promasaji_grananja",
+    "alokacije", "alocirano_bajtova", "vrh_zivih_bajtova", "vrh_rss_bajtova",
+    "h", "model", "konstanta", "eksponent",
+};
+
+/* Vremena se upisuju sa punom preciznoscu, kako bi ucitana osnova bila ista kao izmerena */
+void postaviPreciznost(std::ostream &izlaz)
+{
+    izlaz.precision(std::numeric_limits<double>::max_digits10);
+}
+
+std::string jsonNiska(const std::string &niska)
+{
+    std::string rezultat = "\"";
+    for (char c : niska) {
+        if (c == '"' || c == '\\')
+            rezultat += '\\';
+        rezultat += c;
+    }
+    return rezultat + '"';
+}
+
+/* Tekstualno polje CSV-a; polje sa zarezom ili navodnikom je pod navodnicima
+ * (RFC 4180), a novi red se zamenjuje razmakom, jer se ucitava red po red */
+std::string csvPolje(const std::string &niska)
+{
+    if (niska.find_first_of(",\"\r\n") == std::string::npos)
+        return niska;
+
+    std::string rezultat = "\"";
+    for (char c : niska) {
+        if (c == '"')
+            rezultat += '"';
+        rezultat += c == '\n' || c == '\r' ? ' ' : c;
+    }
+    return rezultat + '"';
+}
+
+std::vector<std::string> podeliRed(const std::string &red)
+{
+    std::vector<std::string> polja(1);
+    bool podNavodnicima = false;
+    for (size_t i = 0; i < red.size(); i++) {
+        const char c = red[i];
+        if (podNavodnicima) {
+            /* Udvojen navodnik je navodnik u polju, a jedan zatvara polje */
+            if (c == '"' && i + 1 < red.size() && red[i + 1] == '"')
+                polja.back() += red[++i];
+            else if (c == '"')
+                podNavodnicima = false;
+            else
+                polja.back() += c;
+        } else if (c == '"') {
+            podNavodnicima = true;
+        } else if (c == ',') {
+            polja.emplace_back();
+        } else {
+            polja.back() += c;
+        }
+    }
+    return polja;
+}
+
+}
+
+double merenje::Regresija::odnos() const
+{
+    return osnova > 0 ? novo / osnova : 0;
+}
+
+#ifndef REVIZIJA_PRI_PREVODJENJU
+const char *merenje::revizijaKoda()
+{
+    return GIT_REVIZIJA;
+}
+#endif
+
+merenje::ProcenaSlozenosti merenje::proceniSlozenost(const std::vector<RezultatMerenja> &rezultati,
+                                                     const RezultatMerenja &uzorak)
+{
+    std::vector<TackaSlozenosti> tacke;
+    for (const auto &r : rezultati)
+        if (r.algoritam == uzorak.algoritam && r.varijanta == uzorak.varijanta &&
+            r.raspodela == uzorak.raspodela && !r.statistika.prekoraceno)
+            tacke.push_back({static_cast<double>(r.brojObjekata), r.statistika.medijana,
+                             r.statistika.velicinaIzlaza});
+    return proceniSlozenost(tacke);
+}
+
+bool merenje::sacuvajJson(const std::vector<RezultatMerenja> &rezultati, const std::string &imeDatoteke)
+{
+    std::ofstream izlaz(imeDatoteke);
+    if (!izlaz)
+        return false;
+    postaviPreciznost(izlaz);
+
+    izlaz << "{\n  \"rezultati\": [";
+    for (const auto &r : rezultati) {
+        const auto &s = r.statistika;
+        izlaz << (&r == &rezultati.front() ? "\n" : ",\n")
+              << "    {\"algoritam\": " << jsonNiska(r.algoritam)
+              << ", \"varijanta\": " << jsonNiska(r.varijanta)
+              << ", \"n\": " << r.brojObjekata
+              << ", \"seme\": " << r.seme
+              << ", \"raspodela\": " << jsonNiska(r.raspodela)
+              << ", \"oblast\": " << r.oblast
+              << ", \"revizija\": " << jsonNiska(r.revizija)
+              << ",\n     \"prekoraceno\": " << (s.prekoraceno ? "true" : "false")
+              << ", \"broj_merenja\": " << s.brojMerenja
+              << ", \"min\": " << s.min
+              << ", \"medijana\": " << s.medijana
+              << ", \"p90\": " << s.p90
+              << ", \"p99\": " << s.p99
+              << ", \"prosek\": " << s.prosek
+              << ", \"sd\": " << s.standardnaDevijacija
+              << ", \"h\": " << s.velicinaIzlaza;
+
+        izlaz << ",\n     \"alokacije\": ";
+        if (s.alokacije.dostupno)
+            izlaz << "{\"broj\": " << s.alokacije.alokacije
+                  << ", \"bajtova\": " << s.alokacije.bajtova
+                  << ", \"vrh_zivih_bajtova\": " << s.alokacije.vrhZivihBajtova
+                  << ", \"vrh_rss_bajtova\": " << s.alokacije.vrhRss << "}";
+        else
+            izlaz << "null";
+
+        izlaz << ",\n     \"brojaci\": ";
+        if (s.brojaci.dostupni)
+            izlaz << "{\"ciklusi\": " << s.brojaci.ciklusi
+                  << ", \"instrukcije\": " << s.brojaci.instrukcije
+                  << ", \"l1_promasaji\": " << s.brojaci.l1Promasaji
+                  << ", \"llc_promasaji\": " << s.brojaci.llcPromasaji
+                  << ", \"promasaji_grananja\": " << s.brojaci.promasajiGrananja << "}";
+        else
+            izlaz << "null";
+
+        izlaz << ",\n     \"faze\": [";
+        for (const auto &faza : s.faze) {
+            izlaz << (&faza == &s.faze.front() ? "" : ", ")
+                  << "{\"ime\": " << jsonNiska(faza.ime) << ", \"trajanje\": " << faza.trajanje;
+            if (faza.udeo >= 0)
+                izlaz << ", \"udeo\": " << faza.udeo;
+            izlaz << "}";
+        }
+        izlaz << "]}";
+    }
+    izlaz << "\n  ],\n  \"procene\": [";
+
+    /* Jedna procena po varijanti, uz prvi red te varijante */
+    bool prva = true;
+    for (auto it = rezultati.begin(); it != rezultati.end(); ++it) {
+        const bool vecProcenjena = std::any_of(rezultati.begin(), it, [&](const RezultatMerenja &r) {
+            return r.algoritam == it->algoritam && r.varijanta == it->varijanta && r.raspodela == it->raspodela;
+        });
+        const auto procena = proceniSlozenost(rezultati, *it);
+        if (vecProcenjena || !procena.uspesna)
+            continue;
+
+        izlaz << (prva ? "\n" : ",\n")
+              << "    {\"algoritam\": " << jsonNiska(it->algoritam)
+              << ", \"varijanta\": " << jsonNiska(it->varijanta)
+              << ", \"raspodela\": " << jsonNiska(it->raspodela)
+              << ", \"model\": " << jsonNiska(imeModela(procena.model))
+              << ", \"konstanta\": " << procena.konstanta
+              << ", \"eksponent\": " << procena.eksponent
+              << ", \"greska\": " << procena.greska << "}";
+        prva = false;
+    }
+    izlaz << "\n  ]\n}\n";
+
+    return static_cast<bool>(izlaz);
+}
+
+bool merenje::sacuvajCsv(const std::vector<RezultatMerenja> &rezultati, const std::string &imeDatoteke)
+{
+    std::ofstream izlaz(imeDatoteke);
+    if (!izlaz)
+        return false;
+    postaviPreciznost(izlaz);
+
+    for (const auto *kolona : KOLONE_CSV)
+        izlaz << (kolona == KOLONE_CSV[0] ? "" : ",") << kolona;
+    izlaz << '\n';
+
+    /* Faze se ne upisuju (razlicit broj po algoritmu); nedostupni brojaci ostaju
+     * prazni, a procena slozenosti varijante se ponavlja u svakom njenom redu */
+    for (const auto &r : rezultati) {
+        const auto &s = r.statistika;
+        izlaz << csvPolje(r.algoritam) << ',' << csvPolje(r.varijanta) << ',' << r.brojObjekata
+              << ',' << r.seme << ',' << csvPolje(r.raspodela) << ',' << r.oblast
+              << ',' << csvPolje(r.revizija)
+              << ',' << s.prekoraceno
+              << ',' << s.brojMerenja << ',' << s.min << ',' << s.medijana << ',' << s.p90
+              << ',' << s.p99 << ',' << s.prosek << ',' << s.standardnaDevijacija;
+        if (s.brojaci.dostupni)
+            izlaz << ',' << s.brojaci.ciklusi << ',' << s.brojaci.instrukcije
+                  << ',' << s.brojaci.l1Promasaji << ',' << s.brojaci.llcPromasaji
+                  << ',' << s.brojaci.promasajiGrananja;
+        else
+            izlaz << ",,,,,";
+        if (s.alokacije.dostupno)
+            izlaz << ',' << s.alokacije.alokacije << ',' << s.alokacije.bajtova
+                  << ',' << s.alokacije.vrhZivihBajtova << ',' << s.alokacije.vrhRss;
+        else
+            izlaz << ",,,,";
+
+        izlaz << ',' << s.velicinaIzlaza;
+        const auto procena = proceniSlozenost(rezultati, r);
+        if (procena.uspesna)
+            izlaz << ',' << csvPolje(imeModela(procena.model)) << ',' << procena.konstanta << ',' << procena.eksponent;
+        else
+            izlaz << ",,,";
+        izlaz << '\n';
+    }
+
+    return static_cast<bool>(izlaz);
+}
+
+bool merenje::ucitajCsv(const std::string &imeDatoteke, std::vector<RezultatMerenja> &rezultati)
+{
+    std::ifstream ulaz(imeDatoteke);
+    std::string red;
+    if (!ulaz || !std::getline(ulaz, red))
+        return false;
+
+    std::map<std::string, size_t> kolone;
+    const auto zaglavlje = podeliRed(red);
+    for (size_t i = 0; i < zaglavlje.size(); i++)
+        kolone[zaglavlje[i]] = i;
+
+    for (const char *potrebna : {"algoritam", "varijanta", "n", "medijana"})
+        if (kolone.find(potrebna) == kolone.end())
+            return false;
+
+    while (std::getline(ulaz, red)) {
+        if (red.empty())
+            continue;
+        const auto polja = podeliRed(red);
+
+        /* Polje iz kolone koje nema (ili je prazno) je prazna niska */
+        const auto polje = [&](const char *ime) -> std::string {
+            const auto it = kolone.find(ime);
+            return it != kolone.end() && it->second < polja.size() ? polja[it->second] : "";
+        };
+        const auto broj = [&](const char *ime) {
+            return std::strtod(polje(ime).c_str(), nullptr);
+        };
+        const auto ceo = [&](const char *ime) -> uint64_t {
+            return std::strtoull(polje(ime).c_str(), nullptr, 10);
+        };
+
+        RezultatMerenja r;
+        r.algoritam = polje("algoritam");
+        r.varijanta = polje("varijanta");
+        r.brojObjekata = std::atoi(polje("n").c_str());
+        r.seme = ceo("seme");
+        r.raspodela = polje("raspodela");
+        r.oblast = std::atoi(polje("oblast").c_str());
+        r.revizija = polje("revizija");
+
+        auto &s = r.statistika;
+        s.prekoraceno = polje("prekoraceno") == "1";
+        s.brojMerenja = std::atoi(polje("broj_merenja").c_str());
+        s.min = broj("min");
+        s.medijana = broj("medijana");
+        s.p90 = broj("p90");
+        s.p99 = broj("p99");
+        s.prosek = broj("prosek");
+        s.standardnaDevijacija = broj("sd");
+
+        s.brojaci.dostupni = !polje("ciklusi").empty();
+        s.brojaci.ciklusi = ceo("ciklusi");
+        s.brojaci.instrukcije = ceo("instrukcije");
+        s.brojaci.l1Promasaji = ceo("l1_promasaji");
+        s.brojaci.llcPromasaji = ceo("llc_promasaji");
+        s.brojaci.promasajiGrananja = ceo("promasaji_grananja");
+        s.velicinaIzlaza = broj("h");
+
+        s.alokacije.dostupno = !polje("alokacije").empty();
+        s.alokacije.alokacije = ceo("alokacije");
+        s.alokacije.bajtova = ceo("alocirano_bajtova");
+        s.alokacije.vrhZivihBajtova = ceo("vrh_zivih_bajtova");
+        s.alokacije.vrhRss = ceo("vrh_rss_bajtova");
+
+        rezultati.push_back(r);
+    }
+
+    return true;
+}
+
+std::vector<merenje::Regresija> merenje::uporedi(const std::vector<RezultatMerenja> &osnova,
+                                                 const std::vector<RezultatMerenja> &novo, double prag)
+{
+    std::vector<Regresija> regresije;
+
+    for (const auto &n : novo) {
+        for (const auto &o : osnova) {
+            if (o.algoritam != n.algoritam || o.varijanta != n.varijanta ||
+                o.brojObjekata != n.brojObjekata || o.raspodela != n.raspodela)
+                continue;
+
+            /* Velicine koje nisu izmerene (npr. bez naivnog) se ne porede; velicina
+             * koja je u osnovi izmerena, a sada prekoracuje budzet, jeste regresija */
+            if (o.statistika.medijana > 0 && n.statistika.prekoraceno)
+                regresije.push_back({n.algoritam, n.varijanta, n.brojObjekata,
+                                     o.statistika.medijana, 0, true});
+            else if (o.statistika.medijana > 0 && n.statistika.medijana > 0 &&
+                     n.statistika.medijana > o.statistika.medijana * (1 + prag))
+                regresije.push_back({n.algoritam, n.varijanta, n.brojObjekata,
+                                     o.statistika.medijana, n.statistika.medijana, false});
+            break;
+        }
+    }
+
+    return regresije;
+}
+
+std::string merenje::opisRegresije(const Regresija &regresija)
+{
+    std::ostringstream opis;
+    opis.precision(3);
+    opis << regresija.algoritam << ' ' << regresija.varijanta << " n = " << regresija.brojObjekata
+         << ": " << regresija.osnova * 1e3 << " ms -> ";
+    if (regresija.prekoraceno)
+        opis << "prekoracen budzet";
+    else
+        opis << regresija.novo * 1e3 << " ms (+"
+             << static_cast<int>(100 * (regresija.odnos() - 1) + 0.5) << "%)";
+    return opis.str();
+}
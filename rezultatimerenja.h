@@ -0,0 +1,78 @@
+#ifndef REZULTATIMERENJA_H
+#define REZULTATIMERENJA_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "merenje.h"
+#include "slozenost.h"
+
+/* Cuvanje rezultata merenja (JSON i CSV) i poredjenje sa sacuvanom osnovom,
+ * kako bi se usporenje izmedju dve verzije koda videlo bez gledanja grafika. */
+namespace merenje {
+
+/* Jedan red rezultata: jedna varijanta algoritma za jednu velicinu ulaza */
+struct RezultatMerenja {
+    std::string algoritam;
+    std::string varijanta;      /* "optimalni" ili "naivni" */
+    int brojObjekata = 0;
+    uint64_t seme = 0;          /* semeZaVelicinu(...); ponavljanje r koristi seme + r */
+    std::string raspodela;
+    int oblast = 0;             /* stranica oblasti 2D ulaza (GeneratorUlaza::stranicaOblasti); 0 ako je nepoznata */
+    std::string revizija;       /* revizija koda (git) kojom je mereno */
+    StatistikaMerenja statistika;
+};
+
+/* Velicina ulaza na kojoj je novo merenje sporije od osnove */
+struct Regresija {
+    std::string algoritam;
+    std::string varijanta;
+    int brojObjekata = 0;
+    double osnova = 0;          /* medijana osnove, u sekundama */
+    double novo = 0;            /* medijana novog merenja, u sekundama */
+    bool prekoraceno = false;   /* novo merenje je prekoracilo budzet */
+
+    double odnos() const;
+};
+
+///
+/// \brief revizijaKoda - git revizija iz vremena prevodjenja (revizija.sh,
+///     odnosno GIT_REVIZIJA iz algoritmi.pri), ili "nepoznata" ako git nije
+///     bio dostupan
+///
+const char *revizijaKoda();
+
+///
+/// \brief proceniSlozenost - procena slozenosti iz svih redova sa istim
+///     algoritmom, varijantom i raspodelom kao uzorak
+///
+ProcenaSlozenosti proceniSlozenost(const std::vector<RezultatMerenja> &rezultati,
+                                   const RezultatMerenja &uzorak);
+
+/* Cuvanje svih redova u datoteku, uz procenu slozenosti svake varijante;
+ * vraca false ako datoteka ne moze da se upise */
+bool sacuvajJson(const std::vector<RezultatMerenja> &rezultati, const std::string &imeDatoteke);
+bool sacuvajCsv(const std::vector<RezultatMerenja> &rezultati, const std::string &imeDatoteke);
+
+///
+/// \brief ucitajCsv - ucitavanje osnove sacuvane sa sacuvajCsv. Kolone se
+///     prepoznaju po imenu iz zaglavlja, pa redosled i dodatne kolone ne smetaju.
+/// \return false ako datoteka ne postoji ili nema kolone potrebne za poredjenje
+///
+bool ucitajCsv(const std::string &imeDatoteke, std::vector<RezultatMerenja> &rezultati);
+
+///
+/// \brief uporedi - poredi medijane redova sa istim algoritmom, varijantom,
+///     velicinom ulaza i raspodelom; red je regresija ako je novo merenje
+///     sporije od osnove za vise od prag (npr. 0.1 = 10%)
+///
+std::vector<Regresija> uporedi(const std::vector<RezultatMerenja> &osnova,
+                               const std::vector<RezultatMerenja> &novo, double prag);
+
+/* Tekstualni prikaz regresije, npr. "konveksni_omotac optimalni n = 1003: 1.2 ms -> 1.5 ms (+25%)" */
+std::string opisRegresije(const Regresija &regresija);
+
+}
+
+#endif // REZULTATIMERENJA_H
@@ -0,0 +1,114 @@
+#include "slozenost.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace {
+
+const char *const imenaModela[] = {
+    "n",
+    "n log n",
+    "n^2",
+    "n^3",
+    "n log h",
+};
+
+/* Najmanji broj tacaka za koji procena ima smisla */
+const size_t NAJMANJE_TACAKA = 3;
+
+/* Vrednost modela; log(1) = 0, pa se logaritam ogranicava odozdo na 1 */
+double vrednostModela(merenje::ModelSlozenosti model, const merenje::TackaSlozenosti &t)
+{
+    switch (model) {
+    case merenje::ModelSlozenosti::N:
+        return t.n;
+    case merenje::ModelSlozenosti::N_LOG_N:
+        return t.n * std::max(1.0, std::log2(t.n));
+    case merenje::ModelSlozenosti::N2:
+        return t.n * t.n;
+    case merenje::ModelSlozenosti::N3:
+        return t.n * t.n * t.n;
+    case merenje::ModelSlozenosti::N_LOG_H:
+        return t.n * std::max(1.0, std::log2(t.h));
+    default:
+        return 0;
+    }
+}
+
+}
+
+const char *merenje::imeModela(ModelSlozenosti model)
+{
+    return imenaModela[static_cast<int>(model)];
+}
+
+std::string merenje::ProcenaSlozenosti::opis() const
+{
+    if (!uspesna)
+        return "nedovoljno merenja";
+
+    std::ostringstream opis;
+    opis.precision(3);
+    opis << imeModela(model) << ", k = " << eksponent;
+    return opis.str();
+}
+
+merenje::ProcenaSlozenosti merenje::proceniSlozenost(const std::vector<TackaSlozenosti> &tacke)
+{
+    ProcenaSlozenosti procena;
+
+    /* Samo tacke koje mogu da se logaritmuju */
+    std::vector<TackaSlozenosti> ispravne;
+    bool poznatIzlaz = true;
+    for (const auto &t : tacke) {
+        if (t.n < 1 || t.vreme <= 0)
+            continue;
+        ispravne.push_back(t);
+        poznatIzlaz = poznatIzlaz && t.h >= 1;
+    }
+    if (ispravne.size() < NAJMANJE_TACAKA)
+        return procena;
+
+    const double m = ispravne.size();
+
+    /* Nagib prave kroz (log n, log vreme) */
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (const auto &t : ispravne) {
+        const double x = std::log2(t.n), y = std::log2(t.vreme);
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+    const double imenilac = m * sxx - sx * sx;
+    procena.eksponent = imenilac > 0 ? (m * sxy - sx * sy) / imenilac : 0;
+
+    /* Za vreme = c f(n), najbolje log c je prosek razlika log(vreme) - log f(n) */
+    for (int i = 0; i < static_cast<int>(ModelSlozenosti::BROJ_MODELA); i++) {
+        const auto model = static_cast<ModelSlozenosti>(i);
+        if (model == ModelSlozenosti::N_LOG_H && !poznatIzlaz)
+            continue;
+
+        double logC = 0;
+        for (const auto &t : ispravne)
+            logC += std::log2(t.vreme) - std::log2(vrednostModela(model, t));
+        logC /= m;
+
+        double greska = 0;
+        for (const auto &t : ispravne) {
+            const double r = std::log2(t.vreme) - std::log2(vrednostModela(model, t)) - logC;
+            greska += r * r;
+        }
+        greska /= m;
+
+        if (!procena.uspesna || greska < procena.greska) {
+            procena.uspesna = true;
+            procena.model = model;
+            procena.konstanta = std::exp2(logC);
+            procena.greska = greska;
+        }
+    }
+
+    return procena;
+}
@@ -0,0 +1,53 @@
+#ifndef SLOZENOST_H
+#define SLOZENOST_H
+
+#include <string>
+#include <vector>
+
+/* Empirijska procena slozenosti iz izmerenih vremena: da li se "optimalni"
+ * algoritam zaista ponasa kao O(n log n), a naivni kao O(n^2) ili O(n^3). */
+namespace merenje {
+
+enum class ModelSlozenosti {
+    N,
+    N_LOG_N,
+    N2,
+    N3,
+    N_LOG_H,            /* h je velicina izlaza (npr. broj temena omotaca) */
+    BROJ_MODELA
+};
+
+/* Npr. "n log n" */
+const char *imeModela(ModelSlozenosti model);
+
+/* Jedno merenje: velicina ulaza, vreme u sekundama i velicina izlaza (0 ako se ne meri) */
+struct TackaSlozenosti {
+    double n;
+    double vreme;
+    double h;
+};
+
+struct ProcenaSlozenosti {
+    bool uspesna = false;
+    ModelSlozenosti model = ModelSlozenosti::N;
+    double konstanta = 0;   /* vreme ~ konstanta * f(n), log je binarni */
+    double eksponent = 0;   /* nagib prave log(vreme) = a + eksponent * log(n) */
+    double greska = 0;      /* srednje kvadratno odstupanje najboljeg modela u log-log prostoru */
+
+    /* Npr. "n log n, k = 1.08" */
+    std::string opis() const;
+};
+
+///
+/// \brief proceniSlozenost - metod najmanjih kvadrata nad log-log podacima:
+///     za svaki model f se trazi konstanta c tako da je log(vreme) - log(c f(n))
+///     najmanje, a bira se model sa najmanjim odstupanjem. Eksponent je nagib
+///     prave provucene kroz sve tacke. Model n log h se razmatra samo ako je
+///     velicina izlaza poznata za svaku tacku.
+/// \return neuspesna procena ako ima manje od tri tacke sa pozitivnim vremenom
+///
+ProcenaSlozenosti proceniSlozenost(const std::vector<TackaSlozenosti> &tacke);
+
+}
+
+#endif // SLOZENOST_H
@@ -1,98 +1,144 @@
 #include "timemeasurementthread.h"
 
+#include <ctime>
+#include <QDebug>
+
 #include "config.h"
-#include "mainwindow.h"
-#include "algoritambaza.h"
 
-/* Ovde ukluciti zaglavlja novih algoritama. */
-#include "./algoritmi_sa_vezbi/ga00_demoiscrtavanja.h"
-#include "./algoritmi_sa_vezbi/ga01_brisucaprava.h"
-#include "./algoritmi_sa_vezbi/ga02_3discrtavanje.h"
-#include "./algoritmi_sa_vezbi/ga03_konveksniomotac.h"
-#include "./algoritmi_sa_vezbi/ga04_konveksniomotac3d.h"
-#include "./algoritmi_sa_vezbi/ga05_preseciduzi.h"
+TimeMeasurementThread::TimeMeasurementThread(TipAlgoritma tipAlgoritma, const merenje::OpsegVelicina &opseg)
+    : QThread(), _algorithmType(tipAlgoritma), _opseg(opseg), _parametri(), _prekid(false)
+{
+    qRegisterMetaType<merenje::StatistikaMerenja>();
+    _parametri.prekid = &_prekid;
+}
 
-#include "./algoritmi_studentski_projekti/watchmanroute.h"
+void TimeMeasurementThread::prekini()
+{
+    _prekid = true;
+}
 
-//#include "ga06_presekPravougaonika.h"
+const std::vector<merenje::RezultatMerenja> &TimeMeasurementThread::rezultati() const
+{
+    return _rezultati;
+}
 
-TimeMeasurementThread::TimeMeasurementThread(TipAlgoritma tipAlgoritma, int minValue, int step, int maxValue)
-    : QThread(), _algorithmType(tipAlgoritma), _minValue(minValue), _step(step), _maxValue(maxValue)
+void TimeMeasurementThread::dodajRezultat(TipAlgoritma tipAlgoritma, const char *varijanta, int brojObjekata,
+                                          uint64_t seme, const merenje::StatistikaMerenja &statistika)
 {
+    if (!statistika.brojMerenja && !statistika.prekoraceno)
+        return;
+
+    merenje::RezultatMerenja r;
+    r.algoritam = merenje::imeAlgoritma(tipAlgoritma);
+    r.varijanta = varijanta;
+    r.brojObjekata = brojObjekata;
+    r.seme = seme;
+    r.raspodela = imeRaspodele(_parametri.raspodela);
+    r.oblast = GeneratorUlaza::stranicaOblasti(brojObjekata, _parametri.raspodela);
+    r.revizija = merenje::revizijaKoda();
+    r.statistika = statistika;
+    _rezultati.push_back(r);
 }
 
 void TimeMeasurementThread::run()
 {
-    clock_t begin, end;
-    double optimalTime, naiveTime;
+    merenje::StatistikaMerenja optimalTime, naiveTime, referentTime;
+
+    /* Npr. Cenov algoritam se na istim ulazima poredi i sa Gremovim */
+    TipAlgoritma referentni = _algorithmType;
+    const bool imaReferentni = merenje::referentniAlgoritam(_algorithmType, referentni);
 
-    AlgoritamBaza *pAlgorithm = nullptr;
+    /* Svako pokretanje poredjenja dobija nove ulaze, ali su u okviru
+     * jednog pokretanja ulazi ponovljivi (seme se izvodi iz pocetnog) */
+    const auto seme = static_cast<uint64_t>(time(nullptr));
+    qInfo("seme = %llu, raspodela = %s", static_cast<unsigned long long>(seme),
+          imeRaspodele(_parametri.raspodela));
 
     /* _i_ je broj nasumicnih tacaka.
      * Kada se radi poredjenje, onda se instancira algoritam sa _i_ nasumicnih tacaka
      * i poredi se vreme izvrsavanja efikasnog i naivnog algoritma
-     * nad tih _i_ nasumicnih tacaka.
+     * nad tih _i_ nasumicnih tacaka, pri cemu se svaka velicina meri
+     * vise puta nad svezim ulazima.
      */
-    for(int i= _minValue; i <= _maxValue; i += _step)
-    {
+    bool optimalniPrekoracen = false;
+    bool naivniPrekoracen = false;
+    bool referentniPrekoracen = !imaReferentni;
 
-        /* Ovde kreirati instancu klase algoritma. */
-        switch (_algorithmType) {
-        case TipAlgoritma::DEMO_ISCRTAVANJA:
-            pAlgorithm = new DemoIscrtavanja(nullptr, 0, false, "", i);
-            break;
-        case TipAlgoritma::BRISUCA_PRAVA:
-            pAlgorithm = new BrisucaPrava(nullptr, 0, false, "", i);
-            break;
-        case TipAlgoritma::_3D_ISCRTAVANJE:
-            pAlgorithm = new BrisucaPrava(nullptr, 0, false, "", i);
-            break;
-        case TipAlgoritma::KONVEKSNI_OMOTAC:
-            pAlgorithm = new KonveksniOmotac(nullptr, 0, false, "", i);
-            break;
-        case TipAlgoritma::KONVEKSNI_OMOTAC_3D:
-            pAlgorithm = new KonveksniOmotac3D(nullptr, 0, false, "", i);
-            break;
-        case TipAlgoritma::PRESECI_DUZI:
-            pAlgorithm = new PreseciDuzi(nullptr, 0, false, "", i);
-            break;
-        case TipAlgoritma::TRIANGULACIJA:
-            pAlgorithm = new Triangulation(nullptr, 0, false, "", i);
-            break;
-        case TipAlgoritma::WATCHMAN_ROUTE:
-            pAlgorithm = new WatchmanRoute(nullptr, 0, false, "", i);
-            break;
-       /* case TipAlgoritma::PRESEK_PRAVOUGAONIKA:
-            pAlgorithm = new PresekPravougaonika(nullptr, 0, false, "", i);
-            break;*/
-        default:
-            break;
-        }
+    for (int i : _opseg.velicine())
+    {
+        const auto semeVelicine = merenje::semeZaVelicinu(seme, i);
 
-        if(pAlgorithm)
-        {
 #ifndef SKIP_OPTIMAL
-            begin = clock();
-            pAlgorithm->pokreniAlgoritam();
-            end = clock();
-            optimalTime = double(end - begin) / CLOCKS_PER_SEC;
+        optimalTime = optimalniPrekoracen ? merenje::StatistikaMerenja()
+                                          : merenje::izmeri(_algorithmType, i, false, _parametri, semeVelicine);
 #else
-            optimalTime = 0;
+        optimalTime = merenje::StatistikaMerenja();
 #endif
 
+        referentTime = referentniPrekoracen ? merenje::StatistikaMerenja()
+                                            : merenje::izmeri(referentni, i, false, _parametri, semeVelicine);
+
 #ifndef SKIP_NAIVE
-            begin = clock();
-            pAlgorithm->pokreniNaivniAlgoritam();
-            end = clock();
-            naiveTime = double(end - begin) / CLOCKS_PER_SEC;
+        naiveTime = naivniPrekoracen ? merenje::StatistikaMerenja()
+                                     : merenje::izmeri(_algorithmType, i, true, _parametri, semeVelicine);
 #else
-            naiveTime = 0;
+        naiveTime = merenje::StatistikaMerenja();
 #endif
-            // std::cout << "Zavrsio oba poziva, stigao do crtanja" << std::endl;
-            emit updateChart(i, optimalTime, naiveTime);
-            delete pAlgorithm;
-            pAlgorithm = nullptr;
+
+        /* Prekid (npr. zatvaranje prozora); nedovrsena velicina se odbacuje */
+        if (_prekid)
+            break;
+
+        /* Varijanta koja prekoraci budzet se ne meri za vece ulaze */
+        if (optimalTime.prekoraceno) {
+            optimalniPrekoracen = true;
+            qInfo("n = %d, optimalni: prekoracen budzet od %g s", i, _parametri.budzet);
+        }
+        if (naiveTime.prekoraceno) {
+            naivniPrekoracen = true;
+            qInfo("n = %d, naivni: prekoracen budzet od %g s", i, _parametri.budzet);
+        }
+        if (referentTime.prekoraceno) {
+            referentniPrekoracen = true;
+            qInfo("n = %d, referentni: prekoracen budzet od %g s", i, _parametri.budzet);
         }
+
+        dodajRezultat(_algorithmType, "optimalni", i, semeVelicine, optimalTime);
+        dodajRezultat(_algorithmType, "naivni", i, semeVelicine, naiveTime);
+        if (imaReferentni)
+            dodajRezultat(referentni, "optimalni", i, semeVelicine, referentTime);
+
+        if (optimalTime.brojMerenja || naiveTime.brojMerenja || referentTime.brojMerenja)
+            emit updateChart(i, optimalTime, naiveTime, referentTime);
+
+        /* Velicina izlaza i oblast ulaza; uz izlazno osetljive algoritme (Cen)
+         * se tek iz h vidi sta poredjenje sa referentnim pokazuje */
+        if (optimalTime.velicinaIzlaza > 0)
+            qInfo("n = %d, h = %g, oblast = %d", i, optimalTime.velicinaIzlaza,
+                  GeneratorUlaza::stranicaOblasti(i, _parametri.raspodela));
+
+        /* Raspodela vremena po fazama, ako algoritam meri faze */
+        if (!optimalTime.faze.empty())
+            qInfo("n = %d, optimalni: %s", i, merenje::opisFaza(optimalTime).c_str());
+        if (!naiveTime.faze.empty())
+            qInfo("n = %d, naivni: %s", i, merenje::opisFaza(naiveTime).c_str());
+        if (!referentTime.faze.empty())
+            qInfo("n = %d, referentni: %s", i, merenje::opisFaza(referentTime).c_str());
+
+        /* Hardverski brojaci; bez njih ostaje samo izmereno vreme */
+        if (optimalTime.brojaci.dostupni)
+            qInfo("n = %d, optimalni: %s", i, optimalTime.brojaci.opis().c_str());
+        if (naiveTime.brojaci.dostupni)
+            qInfo("n = %d, naivni: %s", i, naiveTime.brojaci.opis().c_str());
+
+        /* Alokacije po elementu ulaza i vrh memorije */
+        if (optimalTime.alokacije.dostupno)
+            qInfo("n = %d, optimalni: %s", i, optimalTime.alokacije.opis(i).c_str());
+        if (naiveTime.alokacije.dostupno)
+            qInfo("n = %d, naivni: %s", i, naiveTime.alokacije.opis(i).c_str());
+
+        if (optimalniPrekoracen && naivniPrekoracen && referentniPrekoracen)
+            break;
     }
 
     emit finishChart();
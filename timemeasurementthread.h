@@ -2,6 +2,9 @@
 #define TIMEMEASUREMENTTHREAD_H
 
 #include <QThread>
+#include <QMetaType>
+
+#include <atomic>
 
 /* QChart */
 #include <QtCharts/QChartView>
@@ -10,27 +13,45 @@
 QT_CHARTS_USE_NAMESPACE
 
 #include "algoritambaza.h"
-enum class TipAlgoritma;
+#include "merenje.h"
+#include "rezultatimerenja.h"
+#include "tipalgoritma.h"
+
+/* Statistika se salje iz niti za merenje u GUI nit kroz signal */
+Q_DECLARE_METATYPE(merenje::StatistikaMerenja)
 
 class TimeMeasurementThread : public QThread
 {
     Q_OBJECT
 
 public:
-    TimeMeasurementThread(TipAlgoritma algorithmType, int minValue, int step, int maxValue);
+    TimeMeasurementThread(TipAlgoritma algorithmType, const merenje::OpsegVelicina &opseg);
 
     // QThread interface
     void run() override;
 
+    /* Kooperativni prekid: tekuce izvrsavanje se zaustavlja na prvoj proveri
+     * (AlgoritamBaza_updateCanvasAndBlock), a nit se zatim zavrsava */
+    void prekini();
+
+    /* Svi izmereni redovi; citati tek posle finishChart() */
+    const std::vector<merenje::RezultatMerenja> &rezultati() const;
+
 signals:
-    void updateChart(double dim, double optimal, double naive);
+    /* referentni je optimalni algoritam iz merenje::referentniAlgoritam (neizmeren ako ga nema) */
+    void updateChart(double dim, merenje::StatistikaMerenja optimal, merenje::StatistikaMerenja naive,
+                     merenje::StatistikaMerenja referentni);
     void finishChart();
 
 private:
     const TipAlgoritma _algorithmType;
-    const int _minValue;
-    const int _step;
-    const int _maxValue;
+    const merenje::OpsegVelicina _opseg;
+    merenje::ParametriMerenja _parametri;
+    std::atomic<bool> _prekid;
+    std::vector<merenje::RezultatMerenja> _rezultati;
+
+    void dodajRezultat(TipAlgoritma tipAlgoritma, const char *varijanta, int brojObjekata, uint64_t seme,
+                       const merenje::StatistikaMerenja &statistika);
 };
 
 #endif // TIMEMEASUREMENTTHREAD_H
@@ -0,0 +1,29 @@
+#ifndef TIPALGORITMA_H
+#define TIPALGORITMA_H
+
+/* Enumeracija algoritama; redosled odgovara stavkama padajuceg
+ * menija u mainwindow.ui (separator se umece na mestu SEPARATOR) */
+enum class TipAlgoritma {
+    ALGORITMI_SA_VEZBI,
+    DEMO_ISCRTAVANJA,
+    BRISUCA_PRAVA,
+    _3D_ISCRTAVANJE,
+    KONVEKSNI_OMOTAC,
+    KONVEKSNI_OMOTAC_MONOTONI_LANAC,
+    KONVEKSNI_OMOTAC_CEN,
+    KONVEKSNI_OMOTAC_PARALELNI,
+    KONVEKSNI_OMOTAC_DINAMICKI,
+    KONVEKSNI_OMOTAC_QUICKHULL,
+    KONVEKSNI_OMOTAC_3D,
+    KONVEKSNI_OMOTAC_3D_QUICKHULL,
+    KONVEKSNI_OMOTAC_3D_KONFLIKTI,
+    PRESECI_DUZI,
+    DCEL_DEMO,
+    TRIANGULACIJA,
+    SEPARATOR,
+    STUDENTSKI_PROJEKTI,
+    PRESEK_PRAVOUGAONIKA,
+    WATCHMAN_ROUTE
+};
+
+#endif // TIPALGORITMA_H